@@ -0,0 +1,45 @@
+#include <cmath>
+#include <complex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rtvamp/hostsdk/FFT.hpp"
+
+/**
+ * Real-to-complex FFT of each available backend, block size as argument.
+ */
+static void BM_fft(benchmark::State& state, std::string_view backendName) {
+    const auto  size    = static_cast<size_t>(state.range(0));
+    const auto& backend = rtvamp::hostsdk::getFFTBackend(backendName);
+
+    rtvamp::hostsdk::FFT fft(size, backend);
+    std::vector<float>   input(size);
+    for (size_t i = 0; i < size; ++i) {
+        input[i] = std::sin(0.1F * static_cast<float>(i));
+    }
+
+    for (auto _ : state) {
+        auto output = fft.compute(input);
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+int main(int argc, char** argv) {
+    for (const auto backendName : rtvamp::hostsdk::listFFTBackends()) {
+        benchmark::RegisterBenchmark(
+            ("BM_fft/" + std::string(backendName)).c_str(), BM_fft, backendName
+        )->RangeMultiplier(4)->Range(64, 65536);
+    }
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
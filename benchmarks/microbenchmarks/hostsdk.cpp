@@ -1,3 +1,5 @@
+#include <filesystem>
+
 #include <benchmark/benchmark.h>
 
 #include "rtvamp/hostsdk.hpp"
@@ -26,6 +28,43 @@ static void BM_listPlugins(benchmark::State& state) {
 }
 BENCHMARK(BM_listPlugins);
 
+static void BM_listPluginsParallel(benchmark::State& state) {
+    const auto paths   = rtvamp::hostsdk::getVampPaths();
+    const auto threads = static_cast<unsigned int>(state.range(0));
+    for (auto _ : state) {
+        auto plugins = rtvamp::hostsdk::listPlugins(paths, {.threads = threads});
+        benchmark::DoNotOptimize(plugins);
+    }
+}
+BENCHMARK(BM_listPluginsParallel)->RangeMultiplier(2)->Range(1, 64);
+
+static void BM_listPluginsCacheCold(benchmark::State& state) {
+    const auto paths = rtvamp::hostsdk::getVampPaths();
+    for (auto _ : state) {
+        rtvamp::hostsdk::DiscoveryCache cache;
+        auto plugins = cache.listPlugins(paths);
+        benchmark::DoNotOptimize(plugins);
+    }
+}
+BENCHMARK(BM_listPluginsCacheCold);
+
+static void BM_listPluginsCacheWarm(benchmark::State& state) {
+    const auto paths     = rtvamp::hostsdk::getVampPaths();
+    const auto cacheFile = std::filesystem::temp_directory_path() / "rtvamp-benchmark-discovery.cache";
+    {
+        rtvamp::hostsdk::DiscoveryCache cache(cacheFile);
+        cache.listPlugins(paths);
+        cache.save();
+    }
+    for (auto _ : state) {
+        rtvamp::hostsdk::DiscoveryCache cache(cacheFile);  // includes loading of cache file
+        auto plugins = cache.listPlugins(paths);
+        benchmark::DoNotOptimize(plugins);
+    }
+    std::filesystem::remove(cacheFile);
+}
+BENCHMARK(BM_listPluginsCacheWarm);
+
 static void BM_listPluginsInLibrary(benchmark::State& state) {
     const auto libraries = rtvamp::hostsdk::listLibraries();
     for (auto _ : state) {
@@ -59,6 +98,33 @@ static void BM_loadAllPlugins(benchmark::State& state) {
 }
 BENCHMARK(BM_loadAllPlugins);
 
+static void loadAllPluginsCached(rtvamp::hostsdk::DiscoveryCache& cache) {
+    for (auto&& key : cache.listPlugins(rtvamp::hostsdk::getVampPaths())) {
+        try {
+            const auto libraryPath = cache.findLibrary(key.getLibrary());
+            auto plugin = rtvamp::hostsdk::loadLibrary(libraryPath.value()).loadPlugin(key, 48000);
+            benchmark::DoNotOptimize(plugin);
+        } catch (...) {}
+    }
+}
+
+static void BM_loadAllPluginsCacheCold(benchmark::State& state) {
+    for (auto _ : state) {
+        rtvamp::hostsdk::DiscoveryCache cache;
+        loadAllPluginsCached(cache);
+    }
+}
+BENCHMARK(BM_loadAllPluginsCacheCold);
+
+static void BM_loadAllPluginsCacheWarm(benchmark::State& state) {
+    rtvamp::hostsdk::DiscoveryCache cache;
+    cache.listPlugins(rtvamp::hostsdk::getVampPaths());
+    for (auto _ : state) {
+        loadAllPluginsCached(cache);
+    }
+}
+BENCHMARK(BM_loadAllPluginsCacheWarm);
+
 static void BM_loadAllPluginsCachedLibraryPaths(benchmark::State& state) {
     const auto libraries = rtvamp::hostsdk::listLibraries();
     const auto plugins   = rtvamp::hostsdk::listPlugins(libraries);
@@ -73,4 +139,26 @@ static void BM_loadAllPluginsCachedLibraryPaths(benchmark::State& state) {
 }
 BENCHMARK(BM_loadAllPluginsCachedLibraryPaths);
 
+static void BM_buildPluginRegistry(benchmark::State& state) {
+    for (auto _ : state) {
+        rtvamp::hostsdk::PluginRegistry registry;
+        benchmark::DoNotOptimize(registry);
+    }
+}
+BENCHMARK(BM_buildPluginRegistry);
+
+static void BM_loadAllPluginsRegistry(benchmark::State& state) {
+    const rtvamp::hostsdk::PluginRegistry registry;
+    const auto plugins = registry.listPlugins();
+    for (auto _ : state) {
+        for (auto&& key : plugins) {
+            try {
+                auto plugin = registry.loadPlugin(key, 48000);
+                benchmark::DoNotOptimize(plugin);
+            } catch (...) {}
+        }
+    }
+}
+BENCHMARK(BM_loadAllPluginsRegistry);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rtvamp/hostsdk.hpp"
+
+using rtvamp::hostsdk::Plugin;
+
+static constexpr uint32_t blockSize   = 1024;
+static constexpr size_t   pluginCount = 40;
+
+static std::vector<std::unique_ptr<Plugin>> createPlugins() {
+    constexpr std::string_view keys[] = {  // NOLINT(*avoid-c-arrays)
+        "example-plugin:rms",
+        "example-plugin:spectralrolloff",
+    };
+    std::vector<std::unique_ptr<Plugin>> plugins;
+    for (size_t i = 0; i < pluginCount; ++i) {
+        plugins.push_back(rtvamp::hostsdk::loadPlugin(keys[i % std::size(keys)], 48000));
+    }
+    return plugins;
+}
+
+/**
+ * Process a block with 40 example plugin instances (time and frequency domain) sequentially in
+ * the calling thread, sharing the spectrum of the block.
+ */
+static void BM_serial(benchmark::State& state) {
+    std::vector<std::unique_ptr<Plugin>> plugins;
+    try {
+        plugins = createPlugins();
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    for (auto& plugin : plugins) {
+        plugin->initialise(blockSize, blockSize);
+    }
+
+    rtvamp::hostsdk::SpectralFrontEnd frontEnd(blockSize);
+    const std::vector<float>          signal(blockSize, 1.0F);
+    for (auto _ : state) {
+        const auto spectrum = frontEnd.compute(Plugin::TimeDomainBuffer(signal));
+        for (auto& plugin : plugins) {
+            const bool isTimeDomain = plugin->getInputDomain() == Plugin::InputDomain::Time;
+            benchmark::DoNotOptimize(
+                plugin->process(isTimeDomain ? Plugin::InputBuffer(Plugin::TimeDomainBuffer(signal)) : spectrum, 0)
+            );
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * blockSize));
+}
+BENCHMARK(BM_serial);
+
+/**
+ * Process a block with the same plugins using the PipelineExecutor with a given number of
+ * threads (first argument, 0: hardware concurrency).
+ */
+static void BM_pipelineExecutor(benchmark::State& state) {
+    std::unique_ptr<rtvamp::hostsdk::PipelineExecutor> executor;
+    try {
+        executor = std::make_unique<rtvamp::hostsdk::PipelineExecutor>(
+            createPlugins(), static_cast<unsigned int>(state.range(0))
+        );
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    executor->initialise(blockSize, blockSize);
+
+    const std::vector<float> signal(blockSize, 1.0F);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(executor->process(Plugin::TimeDomainBuffer(signal), 0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * blockSize));
+}
+BENCHMARK(BM_pipelineExecutor)->Arg(1)->Arg(2)->Arg(4)->Arg(0)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,120 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rtvamp/pluginsdk.hpp"
+
+class TestPlugin : public rtvamp::pluginsdk::Plugin<1> {
+public:
+    using Plugin::Plugin;  // inherit constructor
+
+    static constexpr Meta meta{};
+
+    OutputList getOutputDescriptors() const override {
+        return {
+            OutputDescriptor{
+                .identifier  = "output",
+                .name        = "Output",
+                .description = "",
+                .unit        = "",
+                .binCount    = 1,
+            },
+        };
+    }
+
+    bool initialise(uint32_t stepSize, uint32_t blockSize) override {
+        initialiseFeatureSet();
+        return true;
+    }
+
+    void reset() override {}
+
+    const FeatureSet& process(InputBuffer buffer, uint64_t nsec) override {
+        return getFeatureSet();
+    }
+};
+
+class StaticOutputsTestPlugin : public TestPlugin {
+public:
+    using TestPlugin::TestPlugin;  // inherit constructor
+
+    static constexpr std::array outputs{
+        StaticOutputDescriptor{
+            .identifier  = "output",
+            .name        = "Output",
+            .description = "",
+            .unit        = "",
+            .binCount    = 1,
+        },
+    };
+
+    OutputList getOutputDescriptors() const override {
+        return makeOutputList(outputs);
+    }
+};
+
+class PooledTestPlugin : public TestPlugin {
+public:
+    using TestPlugin::TestPlugin;  // inherit constructor
+
+    static constexpr size_t instancePoolSize = 16;
+};
+
+template <typename TPlugin>
+static void BM_instantiateCleanup(benchmark::State& state) {
+    const auto* d = rtvamp::pluginsdk::detail::PluginAdapter<TPlugin>::getDescriptor();
+    for (auto _ : state) {
+        auto* handle = d->instantiate(d, 48000);
+        benchmark::DoNotOptimize(handle);
+        d->cleanup(handle);
+    }
+}
+BENCHMARK(BM_instantiateCleanup<TestPlugin>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_instantiateCleanup<PooledTestPlugin>)->ThreadRange(1, 16)->UseRealTime();
+
+template <typename TPlugin>
+static void BM_instantiateInitialiseCleanup(benchmark::State& state) {
+    const auto* d = rtvamp::pluginsdk::detail::PluginAdapter<TPlugin>::getDescriptor();
+    for (auto _ : state) {
+        auto* handle = d->instantiate(d, 48000);
+        d->initialise(handle, 1, 1024, 1024);
+        benchmark::DoNotOptimize(handle);
+        d->cleanup(handle);
+    }
+}
+BENCHMARK(BM_instantiateInitialiseCleanup<TestPlugin>);
+BENCHMARK(BM_instantiateInitialiseCleanup<PooledTestPlugin>);
+
+template <typename TPlugin>
+static void BM_getOutputDescriptor(benchmark::State& state) {
+    const auto* d      = rtvamp::pluginsdk::detail::PluginAdapter<TPlugin>::getDescriptor();
+    auto*       handle = d->instantiate(d, 48000);
+    for (auto _ : state) {
+        auto* output = d->getOutputDescriptor(handle, 0);
+        benchmark::DoNotOptimize(output);
+        d->releaseOutputDescriptor(output);
+    }
+    d->cleanup(handle);
+}
+BENCHMARK(BM_getOutputDescriptor<TestPlugin>);
+BENCHMARK(BM_getOutputDescriptor<StaticOutputsTestPlugin>);
+
+static void BM_instantiateCleanupLiveInstances(benchmark::State& state) {
+    // cleanup cost must not depend on the number of live instances
+    const auto* d = rtvamp::pluginsdk::detail::PluginAdapter<TestPlugin>::getDescriptor();
+    std::vector<VampPluginHandle> handles(static_cast<size_t>(state.range(0)));
+    for (auto& handle : handles) {
+        handle = d->instantiate(d, 48000);
+    }
+    for (auto _ : state) {
+        auto* handle = d->instantiate(d, 48000);
+        benchmark::DoNotOptimize(handle);
+        d->cleanup(handle);
+    }
+    for (auto* handle : handles) {
+        d->cleanup(handle);
+    }
+}
+BENCHMARK(BM_instantiateCleanupLiveInstances)->RangeMultiplier(10)->Range(1, 10'000);
+
+BENCHMARK_MAIN();
@@ -63,4 +63,34 @@ static void BM_setParameter(benchmark::State& state, std::string_view id) {
 BENCHMARK_CAPTURE(BM_setParameter, limited, "limited");
 BENCHMARK_CAPTURE(BM_setParameter, quantized, "quantized");
 
+static void BM_getParameterHandle(benchmark::State& state) {
+    TestPluginExt plugin(48000);
+    constexpr auto handle = TestPluginExt::resolveParameter("limited");
+    for (auto _ : state) {
+        auto value = plugin.getParameter(handle);
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_getParameterHandle);
+
+static void BM_setParameterHandle(benchmark::State& state, TestPluginExt::ParameterHandle handle) {
+    TestPluginExt plugin(48000);
+    for (auto _ : state) {
+        plugin.setParameter(handle, 11.11f);
+    }
+}
+BENCHMARK_CAPTURE(BM_setParameterHandle, limited, TestPluginExt::resolveParameter("limited"));
+BENCHMARK_CAPTURE(BM_setParameterHandle, quantized, TestPluginExt::resolveParameter("quantized"));
+
+static void BM_setParameterAdapter(benchmark::State& state) {
+    // Vamp C API: index -> plugin (without identifier lookup)
+    const auto* d      = rtvamp::pluginsdk::detail::PluginAdapter<TestPluginExt>::getDescriptor();
+    auto*       handle = d->instantiate(d, 48000);
+    for (auto _ : state) {
+        d->setParameter(handle, 1, 11.11f);
+    }
+    d->cleanup(handle);
+}
+BENCHMARK(BM_setParameterAdapter);
+
 BENCHMARK_MAIN();
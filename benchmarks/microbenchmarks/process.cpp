@@ -0,0 +1,48 @@
+#include <complex>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rtvamp/hostsdk.hpp"
+
+#include "AllocationCounter.hpp"
+
+/**
+ * Process the example plugins (found in the Vamp search paths) and report the heap allocations
+ * per process call as `allocations` counter, which must be zero.
+ */
+static void BM_process(benchmark::State& state, std::string_view key) {
+    constexpr uint32_t blockSize = 1024;
+
+    std::unique_ptr<rtvamp::hostsdk::Plugin> plugin;
+    try {
+        plugin = rtvamp::hostsdk::loadPlugin(key, 48000);
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    plugin->initialise(blockSize, blockSize);
+
+    const std::vector<float>               signal(blockSize, 1.0F);
+    const std::vector<std::complex<float>> spectrum(blockSize / 2 + 1, 1.0F);
+    const auto buffer = plugin->getInputDomain() == rtvamp::hostsdk::Plugin::InputDomain::Time
+        ? rtvamp::hostsdk::Plugin::InputBuffer(signal)
+        : rtvamp::hostsdk::Plugin::InputBuffer(spectrum);
+
+    size_t allocations = 0;
+    for (auto _ : state) {
+        const AllocationCounter counter;  // only count process, not the benchmark loop
+        auto features = plugin->process(buffer, 0);
+        benchmark::DoNotOptimize(features);
+        allocations += counter.count();
+    }
+    state.counters["allocations"] = benchmark::Counter(
+        static_cast<double>(allocations), benchmark::Counter::kAvgIterations
+    );
+}
+BENCHMARK_CAPTURE(BM_process, rms, "example-plugin:rms");
+BENCHMARK_CAPTURE(BM_process, spectralrolloff, "example-plugin:spectralrolloff");
+BENCHMARK_CAPTURE(BM_process, zerocrossing, "minimal-plugin:zerocrossing");
+
+BENCHMARK_MAIN();
@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rtvamp/hostsdk.hpp"
+
+/**
+ * Process one minute of audio (48 kHz) with the RMS example plugin, split into shards processed by
+ * a given number of instances and threads (first argument).
+ */
+static void BM_shardedProcessor(benchmark::State& state) {
+    constexpr size_t sampleCount = 60 * 48000;
+
+    std::unique_ptr<rtvamp::hostsdk::ShardedProcessor> processor;
+    try {
+        const auto libraries = rtvamp::hostsdk::listLibraries();
+        const auto it = std::find_if(libraries.begin(), libraries.end(), [](const auto& path) {
+            return path.stem() == "example-plugin";
+        });
+        if (it == libraries.end()) {
+            throw std::runtime_error("example-plugin not found");
+        }
+        const auto library = rtvamp::hostsdk::loadLibrary(*it);
+        processor = std::make_unique<rtvamp::hostsdk::ShardedProcessor>(
+            library,
+            "example-plugin:rms",
+            48000,
+            rtvamp::hostsdk::ShardedProcessor::Options{
+                .stepSize  = 512,
+                .blockSize = 1024,
+                .threads   = static_cast<unsigned int>(state.range(0)),
+            }
+        );
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    const std::vector<float> signal(sampleCount, 1.0F);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(processor->process(rtvamp::hostsdk::Plugin::TimeDomainBuffer(signal)));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sampleCount));
+}
+BENCHMARK(BM_shardedProcessor)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,42 @@
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rtvamp/hostsdk.hpp"
+
+/**
+ * Stream a signal in pushes of different sizes (first argument) through the RMS example plugin
+ * with a block size of 1024 and a step size of 256 samples.
+ */
+static void BM_streamProcessor(benchmark::State& state) {
+    constexpr uint32_t blockSize = 1024;
+    constexpr uint32_t stepSize  = 256;
+    const auto         pushSize  = static_cast<size_t>(state.range(0));
+
+    std::unique_ptr<rtvamp::hostsdk::Plugin> plugin;
+    try {
+        plugin = rtvamp::hostsdk::loadPlugin("example-plugin:rms", 48000);
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    const std::array<rtvamp::hostsdk::Plugin*, 1> plugins{plugin.get()};
+    rtvamp::hostsdk::StreamProcessor stream(
+        plugins, stepSize, blockSize, 1, [](size_t, uint64_t, auto features) {
+            benchmark::DoNotOptimize(features);
+        }
+    );
+
+    const std::vector<float> signal(pushSize, 1.0F);
+    for (auto _ : state) {
+        stream.pushInterleaved(signal);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * pushSize));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * pushSize * sizeof(float)));
+}
+BENCHMARK(BM_streamProcessor)->RangeMultiplier(4)->Range(64, 65536);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rtvamp/hostsdk/Window.hpp"
+
+constexpr uint32_t blockSize = 1024;
+
+/**
+ * Reference: deinterleave each channel and apply the window in a separate pass (scalar loops like
+ * the previous example host).
+ */
+template <typename T>
+static void BM_deinterleaveWindowScalar(benchmark::State& state) {
+    const auto channelCount = static_cast<size_t>(state.range(0));
+    const auto window       = rtvamp::hostsdk::getWindow(rtvamp::hostsdk::WindowType::Hann, blockSize);
+
+    const std::vector<T>            interleaved(blockSize * channelCount, T{1});
+    std::vector<std::vector<float>> channels(channelCount, std::vector<float>(blockSize));
+
+    for (auto _ : state) {
+        for (size_t c = 0; c < channelCount; ++c) {
+            auto& channel = channels[c];
+            for (size_t i = 0; i < blockSize; ++i) {
+                channel[i] = static_cast<float>(interleaved[i * channelCount + c]);
+            }
+            for (size_t i = 0; i < blockSize; ++i) {
+                channel[i] *= (*window)[i];
+            }
+            benchmark::DoNotOptimize(channel.data());
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * blockSize * channelCount));
+}
+
+/**
+ * Fused kernel: deinterleave, convert and window all channels in a single pass.
+ */
+template <typename T>
+static void BM_deinterleaveWindow(benchmark::State& state) {
+    const auto channelCount = static_cast<size_t>(state.range(0));
+    const auto window       = rtvamp::hostsdk::getWindow(rtvamp::hostsdk::WindowType::Hann, blockSize);
+
+    const std::vector<T>            interleaved(blockSize * channelCount, T{1});
+    std::vector<std::vector<float>> channels(channelCount, std::vector<float>(blockSize));
+    std::vector<std::span<float>>   channelSpans(channels.begin(), channels.end());
+
+    for (auto _ : state) {
+        rtvamp::hostsdk::deinterleaveWindow(std::span<const T>(interleaved), *window, channelSpans);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * blockSize * channelCount));
+}
+
+BENCHMARK(BM_deinterleaveWindowScalar<float>)->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8);
+BENCHMARK(BM_deinterleaveWindow<float>)->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8);
+BENCHMARK(BM_deinterleaveWindowScalar<int16_t>)->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8);
+BENCHMARK(BM_deinterleaveWindow<int16_t>)->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8);
+
+BENCHMARK_MAIN();
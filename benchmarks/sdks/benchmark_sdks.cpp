@@ -33,6 +33,27 @@ BENCHMARK(BM_rtvamp)->Args({4096})->Threads(8)->UseRealTime();
 BENCHMARK(BM_rtvamp)->Args({4096})->Threads(12)->UseRealTime();
 BENCHMARK(BM_rtvamp)->Args({4096})->Threads(16)->UseRealTime();
 
+static void BM_rtvampBatch(benchmark::State& state) {
+    const auto* descriptor = getRtvampDescriptor();
+    rtvamp::hostsdk::PluginHostAdapter adapter(*descriptor, 48000);
+
+    constexpr size_t      blockCount = 256;
+    const size_t          blockSize  = state.range(0);
+    std::vector<float>    inputBuffer(blockCount * blockSize);
+    std::vector<uint64_t> timestamps(blockCount);
+    std::vector<float>    features(blockCount);  // RMS: single output with one bin
+    randomize(inputBuffer);
+
+    adapter.initialise(blockSize, blockSize);
+
+    for (auto _ : state) {
+        adapter.processBatch({inputBuffer, blockSize, timestamps}, features);
+        benchmark::DoNotOptimize(features.data());
+    }
+    state.SetItemsProcessed(state.iterations() * blockCount * blockSize * state.threads());
+}
+BENCHMARK(BM_rtvampBatch)->RangeMultiplier(2)->Range(1 << 4, 1 << 8);
+
 static void BM_vamp(benchmark::State& state) {
     const auto* descriptor = getVampDescriptor();
     Vamp::PluginHostAdapter adapter(descriptor, 48000);
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sndfile.hh>
+
+#include "helper.hpp"
+
+/**
+ * Read an audio file ahead in a background I/O thread.
+ *
+ * The file is decoded in chunks of interleaved samples into two buffers (double buffering): while
+ * the consumer processes one chunk, the I/O thread decodes the next chunk into the other buffer.
+ */
+class AudioReader {
+public:
+    /**
+     * @param path Path to the audio file
+     * @param chunkFrames Number of frames (samples per channel) per chunk
+     * @throw std::runtime_error if the file could not be opened
+     */
+    AudioReader(const std::string& path, size_t chunkFrames) : file_(path) {
+        if (file_.error() != 0) {
+            throw std::runtime_error(concat("Failed to open audio file: ", path, " (", file_.strError(), ")"));
+        }
+        for (auto& buffer : buffers_) {
+            buffer.resize(chunkFrames * static_cast<size_t>(file_.channels()));
+        }
+        thread_ = std::jthread([this](std::stop_token stopToken) { readLoop(stopToken); });
+    }
+
+    AudioReader(const AudioReader&) = delete;
+    AudioReader(AudioReader&&) = delete;
+    AudioReader& operator=(const AudioReader&) = delete;
+    AudioReader& operator=(AudioReader&&) = delete;
+    ~AudioReader() = default;  // stops and joins the I/O thread
+
+    int        sampleRate() const { return file_.samplerate(); }
+    int        channels()   const { return file_.channels(); }
+    sf_count_t frames()     const { return file_.frames(); }
+
+    /**
+     * Get the next chunk of interleaved samples and release the previous chunk.
+     * @return Samples of the chunk (valid until the next call) or an empty span at the end of the file
+     * @throw std::runtime_error if the file could not be read
+     */
+    std::span<const float> next() {
+        std::unique_lock lock(mutex_);
+        if (consumerHoldsBuffer_) {
+            consumerHoldsBuffer_ = false;
+            readIndex_ ^= 1U;
+            cv_.notify_all();
+        }
+        cv_.wait(lock, [&] { return filled_ > 0 || finished_; });
+        if (filled_ == 0) {
+            if (!error_.empty()) {
+                throw std::runtime_error(concat("Error while reading file: ", error_));
+            }
+            return {};
+        }
+        --filled_;
+        consumerHoldsBuffer_ = true;
+        return std::span(buffers_[readIndex_]).first(sizes_[readIndex_]);
+    }
+
+private:
+    void readLoop(std::stop_token stopToken) {
+        size_t writeIndex = 0;
+        while (true) {
+            {
+                // wait for a free buffer (not filled and not processed by the consumer)
+                std::unique_lock lock(mutex_);
+                if (!cv_.wait(lock, stopToken, [&] { return filled_ + (consumerHoldsBuffer_ ? 1 : 0) < 2; })) {
+                    return;  // stop requested
+                }
+            }
+            auto&      buffer = buffers_[writeIndex];
+            const auto count  = file_.read(buffer.data(), static_cast<sf_count_t>(buffer.size()));
+
+            const std::lock_guard lock(mutex_);
+            if (file_.error() != 0) {
+                error_    = file_.strError();
+                finished_ = true;
+            } else if (count <= 0) {
+                finished_ = true;
+            } else {
+                sizes_[writeIndex] = static_cast<size_t>(count);
+                ++filled_;
+                writeIndex ^= 1U;
+            }
+            cv_.notify_all();
+            if (finished_) {
+                return;
+            }
+        }
+    }
+
+    SndfileHandle                     file_;
+    std::array<std::vector<float>, 2> buffers_;
+    std::array<size_t, 2>             sizes_{};  ///< number of samples in each buffer
+    std::mutex                        mutex_;
+    std::condition_variable_any       cv_;
+    size_t                            filled_{0};  ///< decoded buffers, not yet passed to the consumer
+    size_t                            readIndex_{0};  ///< next buffer passed to the consumer
+    bool                              consumerHoldsBuffer_{false};
+    bool                              finished_{false};  ///< end of file or read error
+    std::string                       error_;
+    std::jthread                      thread_;  // last member: stopped and joined first
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>  // memcpy
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "helper.hpp"
+
+/**
+ * Buffered writer for feature rows (timestamp, instance, values) to a file or stdout.
+ *
+ * Rows are formatted into a memory buffer (CSV with std::to_chars, binary with memcpy) and
+ * written with a single fwrite whenever the buffer is full, instead of formatting each value with
+ * iostreams.
+ *
+ * Binary rows are packed in native byte order: `uint64_t` timestamp in nanoseconds, `uint32_t`
+ * instance index and `binCount` float values. The rows are preceded by a header with the magic
+ * "RTVB", the `uint32_t` bin count and the `uint32_t` instance count to parse the rows.
+ */
+class FeatureWriter {
+public:
+    enum class Format { CSV, Binary };
+
+    static constexpr size_t           bufferCapacity = 1 << 20;
+    static constexpr std::string_view binaryMagic    = "RTVB";
+
+    /**
+     * @param path Output file path or empty/"-" for stdout
+     * @throw std::runtime_error if the file could not be opened
+     */
+    FeatureWriter(const std::string& path, Format format) : format_(format) {
+        if (path.empty() || path == "-") {
+            file_ = stdout;
+        } else {
+            file_ = std::fopen(path.c_str(), format == Format::CSV ? "w" : "wb");  // NOLINT(*owning-memory)
+            if (file_ == nullptr) {
+                throw std::runtime_error(concat("Failed to open output file: ", path));
+            }
+            ownsFile_ = true;
+        }
+        buffer_.reserve(bufferCapacity);
+    }
+
+    FeatureWriter(const FeatureWriter&) = delete;
+    FeatureWriter(FeatureWriter&&) = delete;
+    FeatureWriter& operator=(const FeatureWriter&) = delete;
+    FeatureWriter& operator=(FeatureWriter&&) = delete;
+
+    ~FeatureWriter() {
+        try {
+            flush();
+        } catch (...) {}  // NOLINT(*empty-catch)
+        if (ownsFile_) {
+            std::fclose(file_);  // NOLINT(*owning-memory)
+        }
+    }
+
+    /** Write the CSV header (column names) or the binary header (magic, bin and instance count). */
+    void writeHeader(std::string_view outputIdentifier, uint32_t binCount, uint32_t instanceCount) {
+        if (format_ == Format::Binary) {
+            append(binaryMagic);
+            appendBytes(&binCount, sizeof(binCount));
+            appendBytes(&instanceCount, sizeof(instanceCount));
+            return;
+        }
+        append("time,instance");
+        for (uint32_t bin = 0; bin < binCount; ++bin) {
+            append(',');
+            append(outputIdentifier);
+            if (binCount > 1) {
+                append('_');
+                appendNumber(bin);
+            }
+        }
+        append('\n');
+    }
+
+    void write(uint64_t nsec, uint32_t instance, std::span<const float> values) {
+        if (format_ == Format::Binary) {
+            appendBytes(&nsec, sizeof(nsec));
+            appendBytes(&instance, sizeof(instance));
+            appendBytes(values.data(), values.size_bytes());
+        } else {
+            // exact decimal seconds with nanosecond resolution
+            constexpr uint64_t nsecPerSec = 1'000'000'000;
+            appendNumber(nsec / nsecPerSec);
+            append('.');
+            char       fraction[9];  // NOLINT(*avoid-c-arrays)
+            uint64_t   remainder = nsec % nsecPerSec;
+            for (size_t i = sizeof(fraction); i > 0; --i) {
+                fraction[i - 1] = static_cast<char>('0' + remainder % 10);
+                remainder /= 10;
+            }
+            append(std::string_view(fraction, sizeof(fraction)));
+            append(',');
+            appendNumber(instance);
+            for (const float value : values) {
+                append(',');
+                appendNumber(value);
+            }
+            append('\n');
+        }
+        if (buffer_.size() >= bufferCapacity) {
+            flush();
+        }
+    }
+
+    /** Write the buffered rows. */
+    void flush() {
+        if (buffer_.empty()) {
+            return;
+        }
+        if (std::fwrite(buffer_.data(), 1, buffer_.size(), file_) != buffer_.size()) {
+            throw std::runtime_error("Failed to write features");
+        }
+        buffer_.clear();
+        std::fflush(file_);
+    }
+
+private:
+    void append(char c) { buffer_.push_back(c); }
+    void append(std::string_view str) { buffer_.insert(buffer_.end(), str.begin(), str.end()); }
+
+    void appendBytes(const void* data, size_t size) {
+        const size_t offset = buffer_.size();
+        buffer_.resize(offset + size);
+        std::memcpy(buffer_.data() + offset, data, size);  // NOLINT(*pointer-arithmetic)
+    }
+
+    template <typename T>
+    void appendNumber(T value) {
+        char       str[32];  // NOLINT(*avoid-c-arrays)
+        const auto result = std::to_chars(std::begin(str), std::end(str), value);
+        append(std::string_view(std::begin(str), result.ptr));
+    }
+
+    Format            format_;
+    std::FILE*        file_{nullptr};
+    bool              ownsFile_{false};
+    std::vector<char> buffer_;
+};
@@ -1,15 +1,17 @@
+#include <chrono>
 #include <iostream>
+#include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
 
-#include <sndfile.hh>
-
 #include "rtvamp/hostsdk.hpp"
 
-#include "FFT.hpp"
+#include "AudioReader.hpp"
+#include "FeatureWriter.hpp"
 #include "helper.hpp"
 
 using rtvamp::hostsdk::Plugin;
@@ -109,22 +111,25 @@ void listPluginOutputs() {
     }
 }
 
+/** Features of one plugin instance for the blocks of the current chunk. */
+struct InstanceRows {
+    std::vector<uint64_t> timestamps;
+    std::vector<float>    values;
+};
+
 void process(
     std::string_view        pluginKey,
     std::string_view        audiofile,
     std::optional<uint32_t> optionalOutputIndex,
-    std::optional<uint32_t> optionalBlockSize
+    std::optional<uint32_t> optionalBlockSize,
+    std::optional<uint32_t> optionalStepSize,
+    const std::string&      outputFile,
+    std::string_view        format
 ) {
-    // load audio file
-    auto file = SndfileHandle(std::string(audiofile));
-    if (file.error() != 0) {
-        throw std::runtime_error(
-            concat("Failed to open audio file: ", audiofile, " (", file.strError(), ")")
-        );
-    }
-
-    const auto sampleRate = file.samplerate(); 
-    const auto channels   = file.channels();
+    // open audio file, decoded ahead in the I/O thread
+    AudioReader reader(std::string(audiofile), 1 << 16);
+    const auto  sampleRate   = reader.sampleRate();
+    const auto  channelCount = static_cast<uint32_t>(reader.channels());
 
     // load plugin
     auto plugin = rtvamp::hostsdk::loadPlugin(pluginKey, static_cast<float>(sampleRate));
@@ -140,91 +145,146 @@ void process(
     };
 
     const uint32_t blockSize = getBlockSize();
-    const uint32_t stepSize  = blockSize;
-
-    const bool success = plugin->initialise(stepSize, blockSize);
-    if (!success) {
-        throw std::runtime_error("Initialisation failed");
+    const uint32_t stepSize  = optionalStepSize.value_or(
+        plugin->getPreferredStepSize() > 0 ? plugin->getPreferredStepSize() : blockSize
+    );
+
+    // all channels in a single instance if supported, otherwise one instance per channel (fan-out)
+    const bool multiChannel = channelCount >= plugin->getMinChannelCount() &&
+                              channelCount <= plugin->getMaxChannelCount();
+    if (!multiChannel && plugin->getMinChannelCount() > 1) {
+        throw std::runtime_error(
+            concat("Plugin requires at least ", plugin->getMinChannelCount(), " channels")
+        );
+    }
+    const uint32_t instanceCount = multiChannel ? 1 : channelCount;
+
+    // further instances from the same library
+    const auto library = rtvamp::hostsdk::loadLibrary(plugin->getLibraryPath());
+    std::vector<std::unique_ptr<Plugin>> plugins;
+    plugins.push_back(std::move(plugin));
+    while (plugins.size() < instanceCount) {
+        plugins.push_back(library.loadPlugin(pluginKey, static_cast<float>(sampleRate)));
     }
 
+    // frame the chunks into blocks, collect the features of each instance per chunk
+    // (the stream processors initialise the plugins)
     const auto outputIndex = optionalOutputIndex.value_or(0);
-    const auto output = [&] {
-        try {
-            return plugin->getOutputDescriptors().at(outputIndex);
-        } catch (const std::out_of_range&) {
-            throw std::runtime_error("Output index is out of range");
-        }
-    }();
-
-    // print summary
-    std::cout << "Audio file:      " << audiofile << '\n';
-    std::cout << "- sampling rate: " << sampleRate << '\n';
-    std::cout << "- channels:      " << channels << '\n';
-    std::cout << "Plugin:          " << pluginKey << '\n';
-    std::cout << "- output:        " << output.name << " (" << output.description << ")\n";
-    std::cout << "- block size:    " << blockSize << '\n';
-    std::cout << "- step size:     " << stepSize << '\n';
-    std::cout << '\n';
-
-    if (channels > 1) {
-        std::cout << Escape::Yellow
-            << "More than one channel provided. Only first channel will be processed!"
-            << Escape::Reset << "\n\n";
+    std::vector<InstanceRows>                                      rows(instanceCount);
+    std::vector<std::unique_ptr<rtvamp::hostsdk::StreamProcessor>> streams;
+    for (uint32_t i = 0; i < instanceCount; ++i) {
+        Plugin* const instance = plugins[i].get();
+        streams.push_back(std::make_unique<rtvamp::hostsdk::StreamProcessor>(
+            std::span(&instance, 1),
+            stepSize,
+            blockSize,
+            multiChannel ? channelCount : 1,
+            [&rows, i, outputIndex](size_t, uint64_t nsec, Plugin::FeatureSet features) {
+                const auto& values = features[outputIndex];
+                rows[i].timestamps.push_back(nsec);
+                rows[i].values.insert(rows[i].values.end(), values.begin(), values.end());
+            }
+        ));
     }
 
-    // setup FFT if required
-    std::optional<FFT> fft;
-    if (plugin->getInputDomain() == Plugin::InputDomain::Frequency) {
-        fft = FFT();
-        fft->initialise(blockSize);
+    // output descriptors of the initialised plugin
+    const auto outputs = plugins.front()->getOutputDescriptors();
+    if (outputIndex >= outputs.size()) {
+        throw std::runtime_error("Output index is out of range");
+    }
+    const auto output = outputs[outputIndex];
+
+    // print summary (stderr, features are written to stdout by default)
+    std::cerr << "Audio file:      " << audiofile << '\n';
+    std::cerr << "- sampling rate: " << sampleRate << '\n';
+    std::cerr << "- channels:      " << channelCount << '\n';
+    std::cerr << "Plugin:          " << pluginKey << '\n';
+    std::cerr << "- output:        " << output.name << " (" << output.description << ")\n";
+    std::cerr << "- block size:    " << blockSize << '\n';
+    std::cerr << "- step size:     " << stepSize << '\n';
+    std::cerr << "- instances:     " << instanceCount << (multiChannel ? "" : " (one per channel)") << '\n';
+    std::cerr << '\n';
+
+    // columnar feature file with one output per instance or buffered rows
+    std::optional<rtvamp::hostsdk::FeatureFileWriter> featureFile;
+    std::optional<FeatureWriter>                      writer;
+    std::vector<Plugin::FeatureView>                  featureViews(instanceCount);
+    if (format == "columnar") {
+        if (outputFile == "-") {
+            throw std::runtime_error("Columnar feature files require an output file (--outfile)");
+        }
+        std::vector<Plugin::OutputDescriptor> fileOutputs(instanceCount, output);
+        if (instanceCount > 1) {
+            for (uint32_t i = 0; i < instanceCount; ++i) {
+                fileOutputs[i].identifier = concat(output.identifier, '_', i);
+            }
+        }
+        featureFile.emplace(
+            outputFile, pluginKey, fileOutputs, static_cast<float>(sampleRate), stepSize, blockSize
+        );
+    } else {
+        writer.emplace(outputFile, format == "csv" ? FeatureWriter::Format::CSV : FeatureWriter::Format::Binary);
+        writer->writeHeader(output.identifier, output.binCount, instanceCount);
     }
 
-    // initialise buffer
-    const auto         readSize = static_cast<sf_count_t>(blockSize) * channels;
-    std::vector<float> bufferInterleavedChannels(readSize);
-    std::vector<float> bufferChannel(blockSize);
-    std::vector<float> window(hanning(blockSize));
+    // planar buffers for the fan-out
+    std::vector<std::vector<float>> channelBuffers(multiChannel ? 0 : channelCount);
+    std::vector<std::span<float>>   channelViews(channelBuffers.size());
 
-    // process audio block-wise, print timestamps and features
-    const uint64_t nsecIncrement = (1'000'000'000 * blockSize) / sampleRate;
-    uint64_t       nsec = 0;
+    const auto start       = std::chrono::steady_clock::now();
+    uint64_t   frameCount  = 0;
 
-    std::cout << "Time [s]\t" << output.name << " [" << output.unit << "]\n";
+    for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next()) {
+        const size_t frames = chunk.size() / channelCount;
+        frameCount += frames;
 
-    while (file.read(bufferInterleavedChannels.data(), readSize) == readSize) {
-        // deinterleave channels buffer
-        const size_t channel = 0;
-        for (size_t i = 0; i < blockSize; ++i) {
-            bufferChannel[i] = bufferInterleavedChannels[i * channels + channel];
+        for (auto& r : rows) {
+            r.timestamps.clear();
+            r.values.clear();
         }
 
-        const auto getInputBuffer = [&]() -> Plugin::InputBuffer {
-            if (plugin->getInputDomain() == Plugin::InputDomain::Frequency) {
-                // multiply buffer with window (inplace)
-                for (size_t i = 0; i < blockSize; ++i) {
-                    bufferChannel[i] *= window[i];
-                }
-                return fft->compute(bufferChannel);
+        if (multiChannel) {
+            streams.front()->pushInterleaved(chunk);
+        } else {
+            // deinterleave once, then push each channel to its own instance
+            for (size_t c = 0; c < channelCount; ++c) {
+                channelBuffers[c].resize(frames);
+                channelViews[c] = channelBuffers[c];
+            }
+            rtvamp::hostsdk::deinterleaveWindow(chunk, {}, channelViews);
+            for (size_t c = 0; c < channelCount; ++c) {
+                const Plugin::TimeDomainBuffer channel = channelBuffers[c];
+                streams[c]->pushPlanar(std::span(&channel, 1));
             }
-            return bufferChannel;
-        };
-
-        auto featureSet = plugin->process(getInputBuffer(), nsec);
-
-        std::cout << std::fixed << static_cast<double>(nsec) / 1e9 << '\t';
-        for (auto&& feature : featureSet[outputIndex]) {
-            std::cout << feature << '\t';
         }
-        std::cout << '\n';
 
-        nsec += nsecIncrement;
+        // same block grid for all instances: write rows ordered by time, then instance
+        const size_t blockCount = rows.front().timestamps.size();
+        for (size_t block = 0; block < blockCount; ++block) {
+            for (uint32_t i = 0; i < instanceCount; ++i) {
+                const size_t binCount = rows[i].values.size() / blockCount;
+                const auto   values   = std::span(rows[i].values).subspan(block * binCount, binCount);
+                if (featureFile) {
+                    featureViews[i] = values;
+                } else {
+                    writer->write(rows[i].timestamps[block], i, values);
+                }
+            }
+            if (featureFile) {
+                featureFile->write(Plugin::FeatureViewSet(featureViews));
+            }
+        }
     }
-
-    if (file.error() != 0) {
-        throw std::runtime_error(concat("Error while reading file: ", file.strError()));
+    if (featureFile) {
+        featureFile->close();
+    } else {
+        writer->flush();
     }
 
-    std::cout << std::flush;
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const double                        samples = static_cast<double>(frameCount) * channelCount;
+    std::cerr << "Processed " << frameCount << " frames (" << channelCount << " channels) in "
+        << elapsed.count() << " s: " << samples / elapsed.count() << " samples/s\n";
 }
 
 void usage(std::string_view program) {
@@ -238,6 +298,15 @@ void usage(std::string_view program) {
         "options:\n"
         "  --output        output index (default: 0)\n"
         "  --blocksize     block size (default: preferred block size of plugin or 1024)\n"
+        "  --stepsize      step size (default: preferred step size of plugin or block size)\n"
+        "  --format        feature file format: csv, binary or columnar (default: csv)\n"
+        "  --outfile       feature file path (default: stdout)\n"
+        "\n"
+        "  All channels are processed, either by a single instance (if the plugin supports the\n"
+        "  channel count) or by one instance per channel. Features are written in rows of\n"
+        "  time, instance and values (binary: uint64 nanoseconds, uint32 instance, float values,\n"
+        "  preceded by a header with the magic \"RTVB\", uint32 bin count and uint32 instance count).\n"
+        "  Columnar feature files contain one output per instance and require --outfile.\n"
         "\n"
         "  --list, -l      list plugin informations in human readable format\n"
         "  --list-paths    list plugin search paths\n"
@@ -281,9 +350,24 @@ int main(int argc, char* argv[]) {
         const auto audiofile   = parser.args()[parser.nargs() - 1];
         const auto outputIndex = parser.getValueAs<uint32_t>("--output");
         const auto blockSize   = parser.getValueAs<uint32_t>("--blocksize");
+        const auto stepSize    = parser.getValueAs<uint32_t>("--stepsize");
+        const auto outputFile  = parser.getValue("--outfile").value_or("-");
+        const auto format      = parser.getValue("--format").value_or("csv");
+        if (format != "csv" && format != "binary" && format != "columnar") {
+            usage(parser.program());
+            return 2;
+        }
 
         try {
-            process(plugin, audiofile, outputIndex, blockSize);
+            process(
+                plugin,
+                audiofile,
+                outputIndex,
+                blockSize,
+                stepSize,
+                std::string(outputFile),
+                format
+            );
         } catch (const std::exception& e) {
             std::cerr << Escape::Red << "[ERROR] " << e.what() << Escape::Reset << '\n';
             return 1;
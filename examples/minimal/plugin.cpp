@@ -12,6 +12,7 @@ public:
         .copyright     = "MIT",
         .pluginVersion = 1,
         .inputDomain   = InputDomain::Time,
+        .warmUpLength  = 1,  // state: last sample of the previous block
     };
 
     OutputList getOutputDescriptors() const override {
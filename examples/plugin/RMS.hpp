@@ -14,19 +14,23 @@ public:
         .copyright     = "MIT",
         .pluginVersion = 1,
         .inputDomain   = InputDomain::Time,
+        .stateless     = true,
+    };
+
+    // static output descriptors, mapped to the C API at compile time
+    static constexpr std::array outputs{
+        StaticOutputDescriptor{
+            .identifier  = "rms",
+            .name        = "RMS",
+            .description = "Root mean square of signal",
+            .unit        = "V",
+            .binCount    = 1,
+            // use default values for extend and quantization
+        }
     };
 
     OutputList getOutputDescriptors() const override {
-        return {
-            OutputDescriptor{
-                .identifier  = "rms",
-                .name        = "RMS",
-                .description = "Root mean square of signal",
-                .unit        = "V",
-                .binCount    = 1,
-                // use default values for extend and quantization
-            }
-        };
+        return makeOutputList(outputs);
     }
 
     bool initialise(uint32_t stepSize, uint32_t blockSize) override;
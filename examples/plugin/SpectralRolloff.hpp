@@ -14,6 +14,7 @@ public:
         .copyright     = "MIT",
         .pluginVersion = 1,
         .inputDomain   = InputDomain::Frequency,
+        .stateless     = true,
     };
 
     static constexpr std::array parameters{
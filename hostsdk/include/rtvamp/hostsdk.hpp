@@ -5,9 +5,18 @@
 #include <span>
 #include <vector>
 
+#include "rtvamp/hostsdk/DiscoveryCache.hpp"
+#include "rtvamp/hostsdk/FeatureFile.hpp"
+#include "rtvamp/hostsdk/FFT.hpp"
+#include "rtvamp/hostsdk/PipelineExecutor.hpp"
 #include "rtvamp/hostsdk/Plugin.hpp"
 #include "rtvamp/hostsdk/PluginKey.hpp"
 #include "rtvamp/hostsdk/PluginLibrary.hpp"
+#include "rtvamp/hostsdk/PluginRegistry.hpp"
+#include "rtvamp/hostsdk/ShardedProcessor.hpp"
+#include "rtvamp/hostsdk/SpectralFrontEnd.hpp"
+#include "rtvamp/hostsdk/StreamProcessor.hpp"
+#include "rtvamp/hostsdk/Window.hpp"
 
 namespace rtvamp::hostsdk {
 
@@ -39,6 +48,23 @@ PathList listLibraries(const std::filesystem::path& path);
  */
 PathList listLibraries(std::span<const std::filesystem::path> paths);
 
+/**
+ * Options for plugin discovery.
+ */
+struct DiscoveryOptions {
+    /**
+     * Number of threads to probe plugin libraries in parallel (0: hardware concurrency).
+     * The results are deterministic and independent of the number of threads.
+     */
+    unsigned int threads = 0;
+};
+
+/**
+ * List all plugin libraries in custom search paths.
+ * Candidate libraries are probed in parallel (see DiscoveryOptions).
+ */
+PathList listLibraries(std::span<const std::filesystem::path> paths, const DiscoveryOptions& options);
+
 /**
  * Load plugin library by file path.
  */
@@ -59,6 +85,12 @@ std::vector<PluginKey> listPlugins(const std::filesystem::path& path);
  */
 std::vector<PluginKey> listPlugins(std::span<const std::filesystem::path> paths);
 
+/**
+ * List plugins in given list of paths (either search paths or library paths).
+ * Plugin libraries are probed in parallel (see DiscoveryOptions).
+ */
+std::vector<PluginKey> listPlugins(std::span<const std::filesystem::path> paths, const DiscoveryOptions& options);
+
 /**
  * Load plugin.
  */
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rtvamp/hostsdk/Plugin.hpp"
+#include "rtvamp/hostsdk/PluginKey.hpp"
+
+namespace rtvamp::hostsdk {
+
+/**
+ * Persistent index of plugin libraries to speed up plugin discovery.
+ *
+ * Probing a library requires to load it (`dlopen`), which is expensive for a large number of
+ * libraries. The cache stores the result of each probe together with a file stamp (modification
+ * time, file size and inode). Libraries with matching stamps are served from the cache with a
+ * single `stat` call, only new or modified libraries are loaded again.
+ *
+ * The cache can be loaded from and saved to a file. It is not thread-safe.
+ */
+class DiscoveryCache {
+public:
+    /** Static plugin metadata from the plugin descriptor. */
+    struct PluginInfo {
+        std::string         identifier;
+        std::string         name;
+        std::string         description;
+        std::string         maker;
+        std::string         copyright;
+        int                 pluginVersion{};
+        uint32_t            vampApiVersion{};
+        Plugin::InputDomain inputDomain{Plugin::InputDomain::Time};
+    };
+
+    /** Plugin library with metadata of all provided plugins. */
+    struct LibraryInfo {
+        std::filesystem::path   path;
+        std::string             name;  ///< Library name (file stem)
+        std::vector<PluginInfo> plugins;
+    };
+
+    /** Number of libraries served from the cache (hits) or probed by loading (misses). */
+    struct Statistics {
+        size_t hits{0};
+        size_t misses{0};
+    };
+
+    /** Create an empty in-memory cache. */
+    DiscoveryCache() = default;
+
+    /**
+     * Create a cache backed by a file.
+     * Existing entries are loaded from the file, invalid or incompatible files are ignored.
+     */
+    explicit DiscoveryCache(std::filesystem::path cacheFile);
+
+    /**
+     * Get the default cache file path.
+     * A custom path can be set with the `RTVAMP_CACHE_PATH` environment variable.
+     */
+    static std::filesystem::path getDefaultCachePath();
+
+    /** Cache file path (empty for in-memory caches). */
+    const std::filesystem::path& getCachePath() const noexcept { return cacheFile_; }
+
+    /**
+     * Get the library info of a Vamp library.
+     * The library is only loaded if it is not cached yet or was modified since.
+     * @return Library info or `std::nullopt` if the path is not a valid Vamp library
+     */
+    std::optional<LibraryInfo> getLibraryInfo(const std::filesystem::path& libraryPath);
+
+    /**
+     * List all plugin libraries in custom search paths (see rtvamp::hostsdk::listLibraries).
+     */
+    std::vector<std::filesystem::path> listLibraries(std::span<const std::filesystem::path> paths);
+
+    /**
+     * List plugins in given list of paths (see rtvamp::hostsdk::listPlugins).
+     */
+    std::vector<PluginKey> listPlugins(std::span<const std::filesystem::path> paths);
+
+    /**
+     * Find the path of an indexed Vamp library by its name (without filesystem access).
+     * Only libraries indexed by previous calls are considered.
+     */
+    std::optional<std::filesystem::path> findLibrary(std::string_view libraryName) const;
+
+    Statistics getStatistics() const noexcept { return statistics_; }
+
+    /** Remove all entries. */
+    void clear();
+
+    /**
+     * Write the cache to the cache file, if entries were added, updated or removed.
+     * Entries of libraries that were not looked up and have been removed or modified since are
+     * dropped, so the file does not grow with stale entries.
+     * The file is replaced atomically to allow concurrent readers.
+     * @return `true` on success or if nothing had to be written
+     */
+    bool save();
+
+private:
+    struct FileStamp {
+        int64_t  mtime{0};
+        uint64_t size{0};
+        uint64_t inode{0};
+
+        bool operator==(const FileStamp&) const = default;
+    };
+
+    struct Entry {
+        FileStamp                stamp;
+        bool                     isVampLibrary{false};
+        std::string              name;
+        std::vector<PluginInfo>  plugins;
+        bool                     lookedUp{false};  ///< stamp checked in this session (not stored)
+    };
+
+    static std::optional<FileStamp> stat(const std::filesystem::path& path);
+
+    const Entry* lookup(const std::filesystem::path& libraryPath);
+    bool load();
+    void prune();
+
+    std::filesystem::path                  cacheFile_;
+    std::map<std::filesystem::path, Entry> entries_;
+    Statistics                             statistics_;
+    bool                                   modified_{false};
+};
+
+}  // namespace rtvamp::hostsdk
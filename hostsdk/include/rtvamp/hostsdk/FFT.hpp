@@ -0,0 +1,95 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "rtvamp/hostsdk/AlignedAllocator.hpp"
+#include "rtvamp/hostsdk/Plugin.hpp"
+
+namespace rtvamp::hostsdk {
+
+/**
+ * FFT implementation (backend) that creates plans for a fixed transform size.
+ */
+class FFTBackend {
+public:
+    /**
+     * Precomputed real-to-complex transform of a fixed size.
+     * `compute` must be thread-safe, plans are shared by all FFT instances of the same size.
+     */
+    class Plan {
+    public:
+        virtual ~Plan() = default;
+
+        /**
+         * Compute the spectrum (bins 0 to size / 2) of the real input.
+         * @param input Real input with `size` samples
+         * @param output Spectrum with `size / 2 + 1` bins (must not overlap with input)
+         */
+        virtual void compute(std::span<const float> input, std::span<std::complex<float>> output) const = 0;
+    };
+
+    virtual ~FFTBackend() = default;
+
+    virtual std::string_view      getName() const noexcept = 0;
+    virtual std::unique_ptr<Plan> createPlan(size_t size) const = 0;
+};
+
+/**
+ * List names of the available FFT backends, ordered by preference.
+ * The built-in backend (`builtin`) is always available, `kissfft` if found at build time and
+ * `fftw` if enabled with the CMake option `RTVAMP_USE_FFTW` (GPL licensed) and found.
+ */
+std::vector<std::string_view> listFFTBackends();
+
+/**
+ * Get FFT backend by name.
+ * @param name Backend name (as returned by listFFTBackends) or empty for the preferred backend
+ * @throw std::invalid_argument if backend is not available
+ */
+const FFTBackend& getFFTBackend(std::string_view name = {});
+
+/**
+ * Real-to-complex FFT of a fixed size.
+ *
+ * Plans are cached per backend and size and shared by all FFT instances. The output layout
+ * (bins 0 to size / 2) matches the FrequencyDomainBuffer expected by Vamp plugins.
+ */
+class FFT {
+public:
+    /**
+     * @param size Transform size (time domain block size)
+     * @param backend FFT backend
+     * @throw std::invalid_argument if size is zero
+     */
+    explicit FFT(size_t size, const FFTBackend& backend = getFFTBackend());
+
+    size_t            getSize()     const noexcept { return size_; }
+    size_t            getBinCount() const noexcept { return size_ / 2 + 1; }
+    const FFTBackend& getBackend()  const noexcept { return *backend_; }
+
+    /**
+     * Compute the spectrum into the internal (aligned) output buffer.
+     * @return Spectrum, valid until the next compute call
+     * @throw std::invalid_argument if input size does not match
+     */
+    Plugin::FrequencyDomainBuffer compute(std::span<const float> input);
+
+    /**
+     * Compute the spectrum into the given output buffer, e.g. the spectrum of a channel.
+     * @throw std::invalid_argument if input or output size does not match
+     */
+    void compute(std::span<const float> input, std::span<std::complex<float>> output) const;
+
+private:
+    size_t                                  size_;
+    const FFTBackend*                       backend_;
+    std::shared_ptr<const FFTBackend::Plan> plan_;
+    AlignedVector<std::complex<float>>      output_;
+};
+
+}  // namespace rtvamp::hostsdk
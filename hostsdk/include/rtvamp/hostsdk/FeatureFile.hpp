@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rtvamp/hostsdk/Plugin.hpp"
+
+namespace rtvamp::hostsdk {
+
+class MappedFile;
+
+/**
+ * Columnar binary feature file (little-endian).
+ *
+ * Layout:
+ * - Fixed header (64 bytes): magic `RTVFEAT\0`, `uint32` version, `uint32` data offset of the
+ *   first output, `float32` sample rate, `uint32` step size, `uint32` block size, `uint32` output
+ *   count, `uint64` row count, `uint32` plugin key size, zero padding
+ * - Plugin key (UTF-8, without terminating null)
+ * - Output descriptors: `uint32` bin count, `uint32` identifier size, `uint32` name size,
+ *   `uint32` unit size, `uint64` data offset, followed by the identifier, name and unit strings
+ * - Feature data of each output: contiguous row-major `float32` matrix with one row per block and
+ *   `binCount` columns, starting at a 64-byte aligned data offset
+ *
+ * Row `i` belongs to the block starting at sample `i * stepSize` (see FeatureFileReader::getTimestamp).
+ */
+namespace featurefile {
+inline constexpr char     magic[8] = {'R', 'T', 'V', 'F', 'E', 'A', 'T', '\0'};  // NOLINT(*avoid-c-arrays)
+inline constexpr uint32_t version  = 1;
+}  // namespace featurefile
+
+/**
+ * Write features to a columnar feature file.
+ *
+ * The rows are appended to a temporary file per output (stream buffered), so the memory usage
+ * is independent of the signal length. `close` writes the header and copies the features of each
+ * output into a contiguous block of the feature file.
+ */
+class FeatureFileWriter {
+public:
+    /**
+     * Create the feature file.
+     * @param path Path of the feature file
+     * @param pluginKey Key of the plugin, e.g. `example-plugin:rms`
+     * @param outputs Output descriptors (fixed bin count required)
+     * @param sampleRate Input sample rate of the plugin
+     * @param stepSize Initialised step size
+     * @param blockSize Initialised block size
+     * @throw std::invalid_argument if an output has no fixed bin count
+     * @throw std::runtime_error if the file could not be created
+     */
+    FeatureFileWriter(
+        const std::filesystem::path& path,
+        std::string_view             pluginKey,
+        Plugin::OutputList           outputs,
+        float                        sampleRate,
+        uint32_t                     stepSize,
+        uint32_t                     blockSize
+    );
+
+    FeatureFileWriter(const FeatureFileWriter&) = delete;
+    FeatureFileWriter(FeatureFileWriter&&) noexcept;
+    FeatureFileWriter& operator=(const FeatureFileWriter&) = delete;
+    /** Close the current file (errors are ignored) and take over the other writer. */
+    FeatureFileWriter& operator=(FeatureFileWriter&&) noexcept;
+
+    /** Close the file (errors are ignored, call close explicitly to handle them). */
+    ~FeatureFileWriter();
+
+    size_t   getOutputCount() const noexcept { return columns_.size(); }
+    uint64_t getRowCount()    const noexcept { return rowCount_; }
+
+    /**
+     * Append the features of a block (one feature per output).
+     * @throw std::invalid_argument if the number of outputs or values do not match
+     * @throw std::logic_error if the file is closed
+     */
+    void write(Plugin::FeatureSet features);
+    void write(Plugin::FeatureViewSet features);
+
+    /**
+     * Append the features of multiple blocks (e.g. computed by Plugin::processBatch).
+     * @param features Row-major matrix with the concatenated features of all outputs per row
+     * @throw std::invalid_argument if the matrix size is not a multiple of the row size
+     * @throw std::logic_error if the file is closed
+     */
+    void writeMatrix(std::span<const float> features);
+
+    /**
+     * Write header and feature data and close the file.
+     * @throw std::runtime_error if writing failed
+     */
+    void close();
+
+private:
+    struct FileCloser {
+        void operator()(std::FILE* file) const noexcept { std::fclose(file); }  // NOLINT(*owning-memory)
+    };
+    using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+
+    struct Column {
+        std::string identifier;
+        std::string name;
+        std::string unit;
+        uint32_t    binCount{};
+        FilePtr     buffer;  ///< temporary file with the features of the output
+    };
+
+    template <typename Set>
+    void writeSet(const Set& features);
+    void append(Column& column, const float* values, size_t count);
+    void checkOpen() const;
+
+    FilePtr             file_;
+    std::string         pluginKey_;
+    float               sampleRate_;
+    uint32_t            stepSize_;
+    uint32_t            blockSize_;
+    std::vector<Column> columns_;
+    uint64_t            rowCount_{0};
+};
+
+/**
+ * Read a columnar feature file without copying.
+ *
+ * The file is memory-mapped, the features of each output are returned as views into the mapped
+ * memory, valid as long as the reader exists.
+ */
+class FeatureFileReader {
+public:
+    struct Output {
+        std::string identifier;
+        std::string name;
+        std::string unit;
+        uint32_t    binCount{};
+    };
+
+    /**
+     * Map and validate the feature file.
+     * @throw std::runtime_error if the file could not be mapped or is not a valid feature file
+     */
+    explicit FeatureFileReader(const std::filesystem::path& path);
+
+    FeatureFileReader(const FeatureFileReader&) = delete;
+    FeatureFileReader(FeatureFileReader&&) noexcept;
+    FeatureFileReader& operator=(const FeatureFileReader&) = delete;
+    FeatureFileReader& operator=(FeatureFileReader&&) noexcept;
+    ~FeatureFileReader();
+
+    std::string_view        getPluginKey()  const noexcept { return pluginKey_; }
+    float                   getSampleRate() const noexcept { return sampleRate_; }
+    uint32_t                getStepSize()   const noexcept { return stepSize_; }
+    uint32_t                getBlockSize()  const noexcept { return blockSize_; }
+    uint64_t                getRowCount()   const noexcept { return rowCount_; }
+    std::span<const Output> getOutputs()    const noexcept { return outputs_; }
+
+    /**
+     * Get the features of an output.
+     * @return Row-major matrix with `getRowCount()` rows and `binCount` columns (mapped memory)
+     * @throw std::out_of_range if the output index is invalid
+     */
+    std::span<const float>  getFeatures(size_t outputIndex) const;
+
+    /** Exact timestamp of a row in nanoseconds. */
+    uint64_t                getTimestamp(uint64_t row) const noexcept;
+
+private:
+    std::unique_ptr<MappedFile>         file_;
+    std::string                         pluginKey_;
+    float                               sampleRate_{};
+    uint32_t                            stepSize_{};
+    uint32_t                            blockSize_{};
+    uint64_t                            rowCount_{};
+    std::vector<Output>                 outputs_;
+    std::vector<std::span<const float>> features_;
+};
+
+}  // namespace rtvamp::hostsdk
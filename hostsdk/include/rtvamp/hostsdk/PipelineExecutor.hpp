@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "rtvamp/hostsdk/Plugin.hpp"
+#include "rtvamp/hostsdk/SpectralFrontEnd.hpp"
+#include "rtvamp/hostsdk/Window.hpp"
+
+namespace rtvamp::hostsdk {
+
+/**
+ * Process each block with many plugins in parallel.
+ *
+ * The executor owns the plugins and a pool of worker threads, which are started once and wait for
+ * the next block. The process calls of a block are distributed over the workers: each worker gets
+ * a contiguous range of plugins and steals plugins from the ranges of other workers when its own
+ * range is exhausted (balances plugins with different costs). The calling thread works as well.
+ *
+ * The input block is shared read-only, the features of each plugin are written to its own slot.
+ * `process` returns after all plugins processed the block (barrier per block), so the features
+ * are ordered like the plugins and blocks. Each plugin processes the blocks sequentially, but
+ * possibly in different threads.
+ *
+ * Frequency domain plugins get the spectrum of the block, computed once by a SpectralFrontEnd.
+ * The executor itself is not thread-safe.
+ */
+class PipelineExecutor {
+public:
+    /**
+     * @param plugins Plugins with the same input sample rate
+     * @param threads Number of threads including the calling thread (0: hardware concurrency),
+     *                limited to the number of plugins
+     * @throw std::invalid_argument if a plugin is null
+     */
+    explicit PipelineExecutor(std::vector<std::unique_ptr<Plugin>> plugins, unsigned int threads = 0);
+
+    PipelineExecutor(const PipelineExecutor&) = delete;
+    PipelineExecutor(PipelineExecutor&&) = delete;
+    PipelineExecutor& operator=(const PipelineExecutor&) = delete;
+    PipelineExecutor& operator=(PipelineExecutor&&) = delete;
+    ~PipelineExecutor();
+
+    size_t       getPluginCount() const noexcept { return plugins_.size(); }
+    Plugin&      getPlugin(size_t index) const { return *plugins_.at(index); }
+    unsigned int getThreadCount() const noexcept { return static_cast<unsigned int>(ranges_.size()); }
+
+    /**
+     * Initialise all plugins.
+     * @param windowType Window function for frequency domain plugins
+     * @throw std::runtime_error if a plugin initialisation failed
+     */
+    void initialise(
+        uint32_t   stepSize,
+        uint32_t   blockSize,
+        uint32_t   channelCount = 1,
+        WindowType windowType   = WindowType::Hann
+    );
+
+    /** Reset all plugins. */
+    void reset();
+
+    /**
+     * Process a time domain block with all plugins.
+     * @return Features of each plugin, valid until the next process/initialise/reset call
+     * @throw std::logic_error if not initialised
+     * @throw Exceptions of the plugins (first exception, after all plugins finished the block)
+     */
+    std::span<const Plugin::FeatureSet> process(const Plugin::InputBuffer& buffer, uint64_t nsec);
+
+private:
+    struct alignas(64) Range {
+        std::atomic<size_t> next{0};
+        size_t              end{0};
+    };
+
+    void stopWorkers() noexcept;
+    void workerLoop(std::stop_token stopToken, size_t worker);
+    void runTasks(size_t worker);
+    void runPlugin(size_t index);
+
+    std::vector<std::unique_ptr<Plugin>> plugins_;
+    std::vector<Plugin::FeatureSet>      features_;
+    std::vector<bool>                    isTimeDomain_;
+    std::optional<SpectralFrontEnd>      spectralFrontEnd_;
+    bool                                 initialised_{false};
+
+    // current block, written by the calling thread before the epoch is published
+    Plugin::InputBuffer                  input_;
+    Plugin::InputBuffer                  spectrum_;
+    uint64_t                             nsec_{0};
+
+    std::vector<Range>                   ranges_;  ///< plugin range of each thread (calling thread first)
+    alignas(64) std::atomic<uint64_t>    epoch_{0};  ///< incremented for each block
+    alignas(64) std::atomic<size_t>      remaining_{0};  ///< workers that did not finish the block
+    std::mutex                           exceptionMutex_;
+    std::exception_ptr                   exception_;
+    std::vector<std::jthread>            workers_;
+};
+
+}  // namespace rtvamp::hostsdk
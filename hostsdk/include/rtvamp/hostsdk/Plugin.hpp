@@ -24,6 +24,13 @@ public:
     /** Input domain of the plugin. */
     enum class InputDomain { Time, Frequency };
 
+    /** Time positioning of the features of an output. */
+    enum class SampleType {
+        OneSamplePerStep,  ///< One feature per processed block at the block timestamp
+        FixedSampleRate,  ///< Features at a fixed sample rate (OutputDescriptor::sampleRate)
+        VariableSampleRate,  ///< Any number of features with individual timestamps
+    };
+
     struct ParameterDescriptor {
         std::string_view         identifier;
         std::string_view         name;
@@ -36,28 +43,79 @@ public:
         std::vector<std::string_view> valueNames;
     };
 
+    /** Resolved parameter to get/set the value without identifier lookup (see resolveParameter). */
+    struct ParameterHandle {
+        uint32_t                 index{};  ///< Index of the parameter descriptor
+    };
+
+    /** Parameter change at a sample offset within a block (see scheduleParameterEvents). */
+    struct ParameterEvent {
+        uint32_t                 offset{};  ///< Sample offset within the block
+        ParameterHandle          parameter;
+        float                    value{};
+    };
+
     struct OutputDescriptor {
         std::string              identifier;
         std::string              name;
         std::string              description;
         std::string              unit;
+        bool                     hasFixedBinCount{true};
         uint32_t                 binCount{};
         std::vector<std::string> binNames;
         bool                     hasKnownExtents{};
         float                    minValue{};
         float                    maxValue{};
         std::optional<float>     quantizeStep;
+        SampleType               sampleType{SampleType::OneSamplePerStep};
+        float                    sampleRate{};  ///< Sample rate (FixedSampleRate) or resolution (VariableSampleRate)
+        bool                     hasDuration{};
+    };
+
+    /** Feature with time position and optional duration and label (see processEvents). */
+    struct FeatureEvent {
+        uint64_t                 timestamp{};  ///< Timestamp in nanoseconds
+        std::optional<uint64_t>  duration;  ///< Duration in nanoseconds (if provided by the plugin)
+        std::span<const float>   values;
+        std::string_view         label;
     };
 
     using ParameterList          = std::span<const ParameterDescriptor>;  ///< List of parameter descriptors
     using ProgramList            = std::span<const std::string_view>;  ///< List of programs
     using CurrentProgram         = std::optional<std::string_view>;  ///< Current program (if programs avaiable)
-    using OutputList             = std::vector<OutputDescriptor>;  ///< List of output descriptors
+    using OutputList             = std::span<const OutputDescriptor>;  ///< List of output descriptors
+    using ParameterEventList     = std::span<const ParameterEvent>;  ///< Parameter events sorted by offset
     using TimeDomainBuffer       = std::span<const float>;  ///< Time domain buffer
     using FrequencyDomainBuffer  = std::span<const std::complex<float>>;  ///< Frequency domain buffer (FFT)
-    using InputBuffer            = std::variant<TimeDomainBuffer, FrequencyDomainBuffer>;  ///< Input buffer variant
+    using TimeDomainChannels     = std::span<const TimeDomainBuffer>;  ///< Time domain buffers of each channel (planar)
+    using FrequencyDomainChannels = std::span<const FrequencyDomainBuffer>;  ///< Frequency domain buffers of each channel (planar)
+    using InputBuffer            = std::variant<
+        TimeDomainBuffer,
+        FrequencyDomainBuffer,
+        TimeDomainChannels,
+        FrequencyDomainChannels
+    >;  ///< Input buffer variant (single-channel alternatives only valid for one channel)
     using Feature                = std::vector<float>;  ///< Feature with one or more values (defined by OutputDescriptor::binCount)
     using FeatureSet             = std::span<const Feature>;  ///< Computed features for each output
+    using FeatureView            = std::span<const float>;  ///< Feature values owned by the plugin (see processView)
+    using FeatureViewSet         = std::span<const FeatureView>;  ///< Feature views for each output
+    using FeatureEventList       = std::span<const FeatureEvent>;  ///< Feature events of a single output
+    using FeatureEventSet        = std::span<const FeatureEventList>;  ///< Feature events for each output
+    using FeatureMatrix          = std::span<float>;  ///< Row-major matrix with one row per block and the concatenated features of all outputs as columns
+
+    /**
+     * Multiple input blocks in a contiguous buffer for batch processing.
+     *
+     * Block `i` starts at element `i * hopSize` of the buffer (of each channel) and has the
+     * initialised block size (time domain) or `blockSize / 2 + 1` bins (frequency domain).
+     * A hop size equal to the block size describes a contiguous frame matrix, a smaller hop size
+     * describes overlapping blocks of a continuous signal.
+     */
+    struct InputBlocks {
+        InputBuffer               buffer;
+        size_t                    hopSize{};
+        std::span<const uint64_t> timestamps;  ///< Timestamp of each block in nanoseconds (defines number of blocks)
+    };
 
     virtual std::filesystem::path getLibraryPath() const noexcept = 0;
 
@@ -75,6 +133,27 @@ public:
     virtual std::optional<float>  getParameter(std::string_view id) const = 0;
     virtual bool                  setParameter(std::string_view id, float value) = 0;
 
+    /**
+     * Resolve parameter identifier once for fast parameter access (e.g. per block automation).
+     * @return Parameter handle or `std::nullopt` if the parameter is unknown
+     */
+    virtual std::optional<ParameterHandle> resolveParameter(std::string_view id) const = 0;
+    virtual std::optional<float>  getParameter(ParameterHandle handle) const = 0;
+    virtual bool                  setParameter(ParameterHandle handle, float value) = 0;
+
+    /**
+     * Schedule parameter changes within the next processed block (sample-accurate automation).
+     *
+     * The events are passed to the plugin with the next block (process, processView,
+     * processEvents or the first block of processBatch) and replace previously scheduled events.
+     * Plugins supporting sample-accurate automation (pluginsdk::PluginExt) apply the events at
+     * their offsets. Otherwise the events are applied at the block boundaries: events at offset 0
+     * before the block, all other events after the block.
+     * @param events Parameter events sorted by offset
+     * @throw std::invalid_argument if the events are not sorted or a parameter handle is invalid
+     */
+    virtual void                  scheduleParameterEvents(ParameterEventList events) = 0;
+
     virtual ProgramList           getPrograms()       const noexcept = 0;
     virtual CurrentProgram        getCurrentProgram() const = 0;
     virtual bool                  selectProgram(std::string_view name) = 0;
@@ -82,13 +161,92 @@ public:
     virtual uint32_t              getPreferredStepSize()  const = 0;
     virtual uint32_t              getPreferredBlockSize() const = 0;
 
+    virtual uint32_t              getMinChannelCount() const = 0;
+    virtual uint32_t              getMaxChannelCount() const = 0;
+
+    /**
+     * Check if the features of a block only depend on the block itself.
+     * Stateless plugins can process the blocks of a signal in any order or in separate instances.
+     */
+    virtual bool                  isStateless() const = 0;
+
+    /**
+     * Get the number of input samples (per channel) preceding a block, after which the state of
+     * a stateful plugin is independent of any earlier input.
+     * A signal can be processed in segments by separate instances, if each instance first
+     * processes the blocks covering the warm-up length before its segment (see ShardedProcessor).
+     * @return Warm-up length in samples or 0 if unknown (stateless plugins: 0)
+     */
+    virtual uint32_t              getWarmUpLength() const = 0;
+
     virtual uint32_t              getOutputCount()       const = 0;
+
+    /**
+     * Get output descriptors.
+     * Implementations must not modify any state, the descriptors are updated by initialise,
+     * setParameter and selectProgram.
+     * @return Output descriptors (valid until the next initialise, setParameter or selectProgram call)
+     */
     virtual OutputList            getOutputDescriptors() const = 0;
 
-    virtual bool                  initialise(uint32_t stepSize, uint32_t blockSize) = 0;
+    /**
+     * Initialise plugin.
+     * @throw std::invalid_argument if the channel count is not within the supported range
+     */
+    virtual bool                  initialise(uint32_t stepSize, uint32_t blockSize, uint32_t channelCount) = 0;
+    bool                          initialise(uint32_t stepSize, uint32_t blockSize) {
+        return initialise(stepSize, blockSize, 1);
+    }
     virtual void                  reset() = 0;
+
+    /**
+     * Process with exactly one feature per output.
+     * @throw std::logic_error if an output has a variable bin count or is not OneSamplePerStep
+     *                         (use processEvents instead)
+     */
     virtual FeatureSet            process(InputBuffer buffer, uint64_t nsec) = 0;
 
+    /**
+     * Process without copying the features (zero-copy).
+     *
+     * The returned views point directly into the feature memory of the plugin. Release of the
+     * plugin's feature set is deferred, therefore the views are only valid until the next call of
+     * process, processView, processBatch, processEvents, getRemainingFeatures, initialise, reset or
+     * the destruction of the plugin.
+     * Copy the values if they are required longer.
+     */
+    virtual FeatureViewSet        processView(InputBuffer buffer, uint64_t nsec) = 0;
+
+    /**
+     * Process multiple blocks with a single call.
+     *
+     * Same results as calling process for each block, but input validation and dispatch happen
+     * once per batch. The features are written to the caller-provided matrix with one row per
+     * block. The row size is the sum of OutputDescriptor::binCount of all outputs.
+     */
+    virtual void                  processBatch(const InputBlocks& blocks, FeatureMatrix features) = 0;
+
+    /**
+     * Process with any number of timestamped features per output.
+     *
+     * Supports all sample types and variable bin counts. Features without a timestamp are placed
+     * at the block timestamp (OneSamplePerStep, VariableSampleRate) or one period of
+     * OutputDescriptor::sampleRate after the previous feature of the output (FixedSampleRate).
+     * The events and their values are stored in buffers of the plugin, which are reused and only
+     * grow if a call returns more features than any call before. Therefore the returned events are
+     * only valid until the next call of processEvents, getRemainingFeatures, initialise or the
+     * destruction of the plugin.
+     */
+    virtual FeatureEventSet       processEvents(InputBuffer buffer, uint64_t nsec) = 0;
+
+    /**
+     * Get the remaining features after the end of the input.
+     *
+     * Features without a timestamp are placed at the timestamp of the last processed block.
+     * Same storage and lifetime of the returned events as processEvents.
+     */
+    virtual FeatureEventSet       getRemainingFeatures() = 0;
+
     float                         getInputSampleRate() const noexcept { return inputSampleRate_; };
 
 private:
@@ -4,6 +4,7 @@
 #include <filesystem>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -12,12 +13,32 @@
 // forward declarations
 struct _VampPluginDescriptor;  // NOLINT
 typedef _VampPluginDescriptor VampPluginDescriptor;  // NOLINT
+struct _VampFeatureList;  // NOLINT
+typedef _VampFeatureList VampFeatureList;  // NOLINT
 typedef void* VampPluginHandle;  // NOLINT
+struct _RtvampFeature;  // NOLINT
+typedef _RtvampFeature RtvampFeature;  // NOLINT
+struct _RtvampParameterEvent;  // NOLINT
+typedef _RtvampParameterEvent RtvampParameterEvent;  // NOLINT
+struct _RtvampPluginExtension;  // NOLINT
+typedef _RtvampPluginExtension RtvampPluginExtension;  // NOLINT
 
 namespace rtvamp::hostsdk {
 
 class DynamicLibrary;
 
+/**
+ * Host adapter for Vamp plugins.
+ *
+ * If the plugin library exports the rt-vamp extension (plugins built with the rt-vamp pluginsdk),
+ * the plugin is processed directly via the extension instead of the Vamp C API. Scheduled
+ * parameter events are passed with the block in a single call (extension ABI version 2).
+ * Plugins without the extension (or an older version) are reported as stateful with an unknown
+ * warm-up length.
+ *
+ * Output descriptors are queried once and cached until they might change (initialise,
+ * setParameter or selectProgram).
+ */
 class PluginHostAdapter : public Plugin {
 public:
     PluginHostAdapter(
@@ -47,6 +68,10 @@ public:
     ParameterList         getParameterDescriptors() const noexcept override;
     std::optional<float>  getParameter(std::string_view id) const override;
     bool                  setParameter(std::string_view id, float value) override; 
+    std::optional<ParameterHandle> resolveParameter(std::string_view id) const override;
+    std::optional<float>  getParameter(ParameterHandle handle) const override;
+    bool                  setParameter(ParameterHandle handle, float value) override;
+    void                  scheduleParameterEvents(ParameterEventList events) override;
 
     ProgramList           getPrograms()       const noexcept override;
     CurrentProgram        getCurrentProgram() const override;
@@ -55,25 +80,86 @@ public:
     uint32_t              getPreferredStepSize()  const override;
     uint32_t              getPreferredBlockSize() const override;
 
+    uint32_t              getMinChannelCount() const override;
+    uint32_t              getMaxChannelCount() const override;
+
+    bool                  isStateless()     const override;
+    uint32_t              getWarmUpLength() const override;
+
     uint32_t              getOutputCount()       const override;
     OutputList            getOutputDescriptors() const override;
 
-    bool                  initialise(uint32_t stepSize, uint32_t blockSize) override;
+    using Plugin::initialise;
+    bool                  initialise(uint32_t stepSize, uint32_t blockSize, uint32_t channelCount) override;
     void                  reset() override;
     FeatureSet            process(InputBuffer buffer, uint64_t nsec) override;
+    FeatureViewSet        processView(InputBuffer buffer, uint64_t nsec) override;
+    void                  processBatch(const InputBlocks& blocks, FeatureMatrix features) override;
+    FeatureEventSet       processEvents(InputBuffer buffer, uint64_t nsec) override;
+    FeatureEventSet       getRemainingFeatures() override;
+
+    /** Check if the plugin is processed via the rt-vamp extension. */
+    bool                  hasExtension() const noexcept { return extension_ != nullptr; }
 
 private:
+    /** Output properties required for processing, queried once in initialise. */
+    struct OutputInfo {
+        std::string      identifier;
+        uint32_t         binCount{};
+        bool             hasFixedBinCount{true};
+        SampleType       sampleType{SampleType::OneSamplePerStep};
+        float            sampleRate{};
+    };
+
+    /** Growable storage of the feature events of a single output (reused across calls). */
+    struct FeatureEventArena {
+        std::vector<FeatureEvent> events;
+        std::vector<float>        values;
+        std::string               labels;
+        std::optional<uint64_t>   nextTimestamp;  ///< for FixedSampleRate features without timestamp
+
+        void clear() noexcept {
+            events.clear();
+            values.clear();
+            labels.clear();
+        }
+    };
+
+    void refreshOutputDescriptors();
+    void updateOutputDescriptors();
     void checkRequirements();
+    void checkInitialised() const;
+    void checkOneSamplePerStep() const;
+    void checkInputBuffer(const InputBuffer& buffer) const;
+    void checkInputBlockSize(const InputBuffer& buffer) const;
+    const float* const* getInputBuffers(const InputBuffer& buffer, size_t offset = 0);
+    VampFeatureList* callProcess(const float* const* inputBuffers, uint64_t nsec);
+    const RtvampFeature* callProcessExtension(const float* const* inputBuffers, uint64_t nsec);
+    void applyParameterEvents(bool blockStart);
+    void releasePendingFeatureSet();
+    FeatureEventSet collectFeatureEvents(const VampFeatureList* vampFeatureLists, uint64_t nsec);
 
     const VampPluginDescriptor&      descriptor_;
     std::shared_ptr<DynamicLibrary>  library_;
     VampPluginHandle                 handle_{nullptr};
+    const RtvampPluginExtension*     extension_{nullptr};  ///< optional fast path
     std::vector<ParameterDescriptor> parameters_;
     std::vector<std::string_view>    programs_;
+    std::vector<OutputDescriptor>    outputDescriptors_;  ///< cache of getOutputDescriptors
     std::vector<Feature>             featureSet_;
+    std::vector<FeatureView>         featureViews_;
+    VampFeatureList*                 pendingFeatureLists_{nullptr};  ///< not yet released (processView)
+    std::vector<OutputInfo>          outputs_;
+    bool                             oneSamplePerStep_{true};  ///< all outputs OneSamplePerStep with fixed bin count
+    std::vector<FeatureEventArena>   eventArenas_;
+    std::vector<FeatureEventList>    eventLists_;
+    uint64_t                         lastTimestamp_{0};  ///< of last processed block (remaining features)
+    std::vector<RtvampParameterEvent> parameterEvents_;  ///< scheduled for the next block
+    std::vector<const float*>        inputBuffers_{nullptr};  ///< input pointer of each channel
     uint32_t                         outputCount_{0};
     bool                             initialised_{false};
     uint32_t                         initialisedBlockSize_{0};
+    uint32_t                         initialisedChannelCount_{1};
 };
 
 }  // namespace rtvamp::hostsdk
@@ -15,6 +15,7 @@ typedef _VampPluginDescriptor VampPluginDescriptor;  // NOLINT
 namespace rtvamp::hostsdk {
 
 class DynamicLibrary;
+class PluginLibraryAccess;
 
 class PluginLibrary {
 public:
@@ -31,6 +32,11 @@ public:
     std::unique_ptr<Plugin> loadPlugin(size_t index, float inputSampleRate) const;
 
 private:
+    friend class PluginLibraryAccess;
+
+    /** Construct from an already loaded dynamic library (internal, avoids loading twice). */
+    explicit PluginLibrary(std::shared_ptr<DynamicLibrary> library);
+
     std::shared_ptr<DynamicLibrary>          dl_;
     std::vector<const VampPluginDescriptor*> descriptors_;
 };
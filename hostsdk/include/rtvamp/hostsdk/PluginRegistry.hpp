@@ -0,0 +1,77 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>  // equal_to, hash
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "rtvamp/hostsdk/Plugin.hpp"
+#include "rtvamp/hostsdk/PluginKey.hpp"
+#include "rtvamp/hostsdk/PluginLibrary.hpp"
+
+namespace rtvamp::hostsdk {
+
+/**
+ * Index of all plugins in the search paths to load plugins without filesystem access.
+ *
+ * The plugin libraries are discovered and loaded once during construction and kept alive for the
+ * lifetime of the registry. Plugins are looked up by their key in constant time.
+ * If multiple libraries share the same name, the first one found in the search paths is used
+ * (same precedence as rtvamp::hostsdk::loadPlugin).
+ *
+ * All const methods are thread-safe.
+ */
+class PluginRegistry {
+public:
+    /** Build registry from default Vamp search paths. */
+    PluginRegistry();
+
+    /** Build registry from given list of paths (either search paths or library paths). */
+    explicit PluginRegistry(std::span<const std::filesystem::path> paths);
+
+    size_t                  getLibraryCount() const noexcept { return libraries_.size(); }
+    size_t                  getPluginCount()  const noexcept { return plugins_.size(); }
+
+    /** List plugins (sorted). */
+    std::vector<PluginKey>  listPlugins() const;
+
+    bool                    contains(const PluginKey& key) const;
+
+    /**
+     * Find plugin library by its name.
+     * @return Pointer to plugin library or `nullptr` if not found
+     */
+    const PluginLibrary*    findLibrary(std::string_view libraryName) const;
+
+    /**
+     * Load plugin.
+     * @throw std::invalid_argument if plugin is not found
+     */
+    std::unique_ptr<Plugin> loadPlugin(const PluginKey& key, float inputSampleRate) const;
+
+private:
+    struct StringHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view str) const noexcept {
+            return std::hash<std::string_view>{}(str);
+        }
+    };
+
+    template <typename T>
+    using StringMap = std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
+    struct PluginEntry {
+        size_t libraryIndex;
+        size_t pluginIndex;
+    };
+
+    std::vector<PluginLibrary> libraries_;
+    StringMap<size_t>          libraryIndices_;  ///< library name -> index of libraries_
+    StringMap<PluginEntry>     plugins_;  ///< plugin key -> library and plugin index
+};
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "rtvamp/hostsdk/Plugin.hpp"
+#include "rtvamp/hostsdk/PluginKey.hpp"
+#include "rtvamp/hostsdk/SpectralFrontEnd.hpp"
+#include "rtvamp/hostsdk/Window.hpp"
+
+namespace rtvamp::hostsdk {
+
+class PluginLibrary;
+
+/**
+ * Process a long signal offline in parallel with multiple instances of the same plugin.
+ *
+ * The blocks of the signal are split into contiguous segments (shards), one per instance and
+ * thread. Each instance is reset and primed with the blocks of the warm-up length preceding its
+ * shard, the features of these warm-up blocks are discarded. The features of all shards are
+ * written into one feature matrix, ordered by the block timestamps. The results are equal to
+ * processing all blocks with a single instance.
+ *
+ * Sharding is only used if it is safe: for stateless plugins (without warm-up) and stateful
+ * plugins with a known warm-up length (declared by the plugin or given in the options). All other
+ * plugins process the whole signal with a single instance.
+ *
+ * Only complete blocks are processed (like StreamProcessor). Frequency domain plugins get the
+ * spectrum of each block computed by a SpectralFrontEnd of the instance.
+ */
+class ShardedProcessor {
+public:
+    struct Options {
+        uint32_t                stepSize{};
+        uint32_t                blockSize{};
+        uint32_t                channelCount{1};
+        unsigned int            threads{0};  ///< Number of instances and threads (0: hardware concurrency)
+        std::optional<uint32_t> warmUpLength{};  ///< Warm-up length of stateful plugins in samples (0: unknown), overrides the declared value
+        WindowType              windowType{WindowType::Hann};  ///< Window function for frequency domain plugins
+    };
+
+    /** Features of all processed blocks. */
+    struct Result {
+        std::vector<uint64_t> timestamps;  ///< Timestamp of each block in nanoseconds (ascending)
+        std::vector<float>    features;  ///< Row-major matrix with one row per block (see Plugin::FeatureMatrix)
+        size_t                rowSize{};  ///< Number of columns, sum of the bin counts of all outputs
+    };
+
+    /**
+     * Load and initialise the plugin instances.
+     * @throw std::invalid_argument if step size, block size or channel count is zero
+     * @throw std::runtime_error if the plugin could not be loaded or initialised
+     */
+    ShardedProcessor(
+        const PluginLibrary& library,
+        const PluginKey&     key,
+        float                inputSampleRate,
+        const Options&       options
+    );
+
+    ShardedProcessor(const ShardedProcessor&) = delete;
+    ShardedProcessor(ShardedProcessor&&) noexcept = default;
+    ShardedProcessor& operator=(const ShardedProcessor&) = delete;
+    ShardedProcessor& operator=(ShardedProcessor&&) noexcept = default;
+    ~ShardedProcessor() = default;
+
+    size_t   getPluginCount()  const noexcept { return instances_.size(); }
+    Plugin&  getPlugin(size_t index) const { return *instances_.at(index).plugin; }
+
+    /** Check if the signal is split into shards (stateless or known warm-up length). */
+    bool     isShardable()     const noexcept { return shardable_; }
+
+    /** Number of warm-up blocks processed before each shard. */
+    uint32_t getWarmUpBlocks() const noexcept { return warmUpBlocks_; }
+
+    /**
+     * Set a parameter of all instances.
+     * @return `true` if the parameter was set for all instances
+     */
+    bool     setParameter(std::string_view id, float value);
+
+    /**
+     * Select a program of all instances.
+     * @return `true` if the program was selected for all instances
+     */
+    bool     selectProgram(std::string_view name);
+
+    /**
+     * Process all complete blocks of the signal.
+     * @param signal Time domain signal (single channel or planar channels)
+     * @throw std::invalid_argument if the signal is not in time domain or the channel count or
+     *                              channel sizes do not match
+     * @throw Exceptions of the plugins (first exception, after all shards finished)
+     */
+    Result   process(const Plugin::InputBuffer& signal);
+
+private:
+    struct Instance {
+        std::unique_ptr<Plugin>         plugin;
+        std::optional<SpectralFrontEnd> spectralFrontEnd;  ///< only for frequency domain plugins
+        std::vector<float>              warmUpFeatures;  ///< discarded features of the warm-up blocks
+    };
+
+    void processBlocks(
+        Instance&                                 instance,
+        std::span<const Plugin::TimeDomainBuffer> channels,
+        std::span<const uint64_t>                 timestamps,
+        size_t                                    firstBlock,
+        size_t                                    blockCount,
+        Plugin::FeatureMatrix                     features
+    ) const;
+
+    uint32_t              stepSize_;
+    uint32_t              blockSize_;
+    uint32_t              channelCount_;
+    bool                  shardable_{false};
+    uint32_t              warmUpBlocks_{0};
+    std::vector<Instance> instances_;
+};
+
+}  // namespace rtvamp::hostsdk
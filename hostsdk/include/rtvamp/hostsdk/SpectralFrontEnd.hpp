@@ -0,0 +1,71 @@
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "rtvamp/hostsdk/AlignedAllocator.hpp"
+#include "rtvamp/hostsdk/FFT.hpp"
+#include "rtvamp/hostsdk/Plugin.hpp"
+#include "rtvamp/hostsdk/Window.hpp"
+
+namespace rtvamp::hostsdk {
+
+/**
+ * Window and transform time domain blocks to the frequency domain input of Vamp plugins.
+ *
+ * Each block is transformed once with the FFT, the spectrum can be passed to any number
+ * of frequency domain plugins initialised with the same block size. The spectrum is valid until
+ * the next compute call.
+ */
+class SpectralFrontEnd {
+public:
+    /**
+     * @param blockSize Block size in samples (time domain)
+     * @param channelCount Number of input channels
+     * @param windowType Window function applied before the FFT
+     * @param backend FFT backend
+     * @throw std::invalid_argument if block size or channel count is zero
+     */
+    explicit SpectralFrontEnd(
+        uint32_t          blockSize,
+        uint32_t          channelCount = 1,
+        WindowType        windowType   = WindowType::Hann,
+        const FFTBackend& backend      = getFFTBackend()
+    );
+
+    SpectralFrontEnd(const SpectralFrontEnd&) = delete;
+    SpectralFrontEnd(SpectralFrontEnd&&) noexcept = default;
+    SpectralFrontEnd& operator=(const SpectralFrontEnd&) = delete;
+    SpectralFrontEnd& operator=(SpectralFrontEnd&&) noexcept = default;
+    ~SpectralFrontEnd() = default;
+
+    uint32_t               getBlockSize()    const noexcept { return blockSize_; }
+    uint32_t               getBinCount()     const noexcept { return blockSize_ / 2 + 1; }
+    uint32_t               getChannelCount() const noexcept { return channelCount_; }
+    WindowType             getWindowType()   const noexcept { return windowType_; }
+    std::span<const float> getWindow()       const noexcept { return *window_; }
+
+    /**
+     * Window and transform a time domain block of each channel.
+     * @return Frequency domain input buffer (single or planar channels like the given input)
+     * @throw std::invalid_argument if input is not in time domain or block size/channel count do not match
+     */
+    Plugin::InputBuffer compute(const Plugin::InputBuffer& timeDomain);
+
+private:
+    void computeChannel(Plugin::TimeDomainBuffer input, uint32_t channel);
+
+    uint32_t                                  blockSize_;
+    uint32_t                                  channelCount_;
+    WindowType                                windowType_;
+    std::shared_ptr<const AlignedVector<float>> window_;
+    FFT                                       fft_;
+    AlignedVector<float>                      windowed_;
+    AlignedVector<std::complex<float>>        spectrum_;  ///< planar, `binCount` bins per channel
+    std::vector<Plugin::FrequencyDomainBuffer> spectrumChannels_;
+};
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "rtvamp/hostsdk/Plugin.hpp"
+#include "rtvamp/hostsdk/SpectralFrontEnd.hpp"
+
+namespace rtvamp::hostsdk {
+
+/**
+ * Frame a continuous stream of samples into (overlapping) blocks and process them with plugins.
+ *
+ * Samples are pushed in chunks of arbitrary size, either interleaved or planar. They are stored in
+ * a ring buffer, which keeps the overlap of consecutive blocks (`stepSize < blockSize`). The ring
+ * buffer is mirrored: the first `blockSize` samples of each channel are written a second time
+ * behind the end of the buffer, so every block is contiguous and passed to the plugins without
+ * copying.
+ *
+ * Each complete block is processed by all plugins, the features are passed to the callback.
+ * Time domain plugins get the raw block. If frequency domain plugins are used, the block is
+ * windowed and transformed once by a shared SpectralFrontEnd and the spectrum is passed to all of
+ * them.
+ * Timestamps are computed from the absolute sample position with integer arithmetic (exact for
+ * integer sample rates), therefore they do not drift on long streams.
+ *
+ * Writing (write* methods) and processing (process) can run in two different threads (single
+ * producer, single consumer) without locks. The push* methods write and process in the calling
+ * thread.
+ */
+class StreamProcessor {
+public:
+    /** Called for each processed block and plugin. */
+    using Callback = std::function<void(size_t pluginIndex, uint64_t nsec, Plugin::FeatureSet features)>;
+
+    /**
+     * Initialise the plugins with the given step size, block size and channel count.
+     * @param plugins Plugins with the same input sample rate (must outlive the stream processor)
+     * @param stepSize Step size in samples (must be > 0)
+     * @param blockSize Block size in samples (must be > 0)
+     * @param channelCount Number of input channels
+     * @param callback Callback for the features of each block and plugin
+     * @param capacity Ring buffer capacity in samples per channel (at least `2 * blockSize`)
+     * @param windowType Window function for frequency domain plugins
+     * @throw std::invalid_argument if the arguments or plugins are invalid
+     * @throw std::runtime_error if a plugin initialisation failed
+     */
+    StreamProcessor(
+        std::span<Plugin* const> plugins,
+        uint32_t                 stepSize,
+        uint32_t                 blockSize,
+        uint32_t                 channelCount,
+        Callback                 callback,
+        size_t                   capacity   = 0,
+        WindowType               windowType = WindowType::Hann
+    );
+
+    StreamProcessor(const StreamProcessor&) = delete;
+    StreamProcessor(StreamProcessor&&) = delete;
+    StreamProcessor& operator=(const StreamProcessor&) = delete;
+    StreamProcessor& operator=(StreamProcessor&&) = delete;
+    ~StreamProcessor() = default;
+
+    uint32_t getStepSize()     const noexcept { return stepSize_; }
+    uint32_t getBlockSize()    const noexcept { return blockSize_; }
+    uint32_t getChannelCount() const noexcept { return channelCount_; }
+    size_t   getCapacity()     const noexcept { return capacity_; }
+
+    /** Number of samples (per channel) that can be written without processing. */
+    size_t   getWritableSamples() const noexcept;
+
+    /**
+     * Write interleaved samples (producer).
+     * @return Number of written samples per channel (limited by the free space of the buffer)
+     * @throw std::invalid_argument if the size is not a multiple of the channel count
+     */
+    size_t   writeInterleaved(std::span<const float> samples);
+
+    /**
+     * Write planar samples (producer).
+     * @return Number of written samples per channel (limited by the free space of the buffer)
+     * @throw std::invalid_argument if the channel count or channel sizes do not match
+     */
+    size_t   writePlanar(std::span<const std::span<const float>> channels);
+
+    /**
+     * Process all complete blocks (consumer).
+     * @return Number of processed blocks
+     */
+    size_t   process();
+
+    /** Write and process interleaved samples of any size. */
+    void     pushInterleaved(std::span<const float> samples);
+
+    /** Write and process planar samples of any size. */
+    void     pushPlanar(std::span<const std::span<const float>> channels);
+
+    /**
+     * Discard buffered samples, reset the plugins and restart the timestamps at zero.
+     * Must not be called concurrently to the write or process methods.
+     */
+    void     reset();
+
+    /** Exact timestamp of a sample position in nanoseconds. */
+    uint64_t getTimestamp(uint64_t samplePosition) const noexcept;
+
+private:
+    template <typename CopyChannel>
+    size_t write(size_t sampleCount, CopyChannel&& copyChannel);
+
+    std::vector<Plugin*>               plugins_;
+    uint32_t                           stepSize_;
+    uint32_t                           blockSize_;
+    uint32_t                           channelCount_;
+    Callback                           callback_;
+    size_t                             capacity_;
+    float                              sampleRate_;
+    std::vector<float>                 buffer_;  ///< planar, `capacity + blockSize` samples per channel
+    std::vector<Plugin::TimeDomainBuffer> blockChannels_;  ///< block views of each channel
+    std::optional<SpectralFrontEnd>    spectralFrontEnd_;  ///< only if frequency domain plugins are used
+    std::atomic<uint64_t>              writePosition_{0};  ///< total samples written
+    std::atomic<uint64_t>              readPosition_{0};  ///< sample position of the next block
+};
+
+}  // namespace rtvamp::hostsdk
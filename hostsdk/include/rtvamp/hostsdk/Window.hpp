@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "rtvamp/hostsdk/AlignedAllocator.hpp"
+
+namespace rtvamp::hostsdk {
+
+/** Window function, e.g. applied before the FFT. */
+enum class WindowType { Rectangular, Hann, Hamming, Blackman, BlackmanHarris, Kaiser };
+
+/** Default shape parameter of the Kaiser window (side lobes similar to the Blackman window). */
+inline constexpr float defaultKaiserBeta = 8.6F;
+
+/**
+ * Get a symmetric window of the given type and length (equal to `numpy.hanning`, `numpy.kaiser`, ...).
+ *
+ * Windows are precomputed tables with aligned storage, cached by type and length (and beta for
+ * the Kaiser window) and shared by all callers while in use.
+ * Thread-safe.
+ *
+ * @param kaiserBeta Shape parameter of the Kaiser window (ignored by other windows)
+ */
+std::shared_ptr<const AlignedVector<float>> getWindow(
+    WindowType type, uint32_t length, float kaiserBeta = defaultKaiserBeta
+);
+
+/**
+ * Multiply the input with the window (`output[i] = input[i] * window[i]`).
+ * Input and output may be the same buffer.
+ * @throw std::invalid_argument if the sizes do not match
+ */
+void applyWindow(std::span<const float> input, std::span<const float> window, std::span<float> output);
+
+/**
+ * Deinterleave, convert and window all channels in a single pass over the interleaved input.
+ *
+ * Integer samples are converted to float in the range [-1, 1). The kernels are written for
+ * auto-vectorisation: mono and stereo input in a single loop over the frames, more channels in
+ * cache-sized tiles with contiguous stores per channel.
+ *
+ * @param interleaved Interleaved input with `frames * channels.size()` samples
+ * @param window Window with `frames` values or empty to only deinterleave and convert
+ * @param channels Output buffer of each channel with `frames` samples
+ * @throw std::invalid_argument if the sizes do not match
+ */
+void deinterleaveWindow(
+    std::span<const float> interleaved, std::span<const float> window, std::span<const std::span<float>> channels
+);
+void deinterleaveWindow(
+    std::span<const int16_t> interleaved, std::span<const float> window, std::span<const std::span<float>> channels
+);
+void deinterleaveWindow(
+    std::span<const int32_t> interleaved, std::span<const float> window, std::span<const std::span<float>> channels
+);
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,401 @@
+#include "rtvamp/hostsdk/DiscoveryCache.hpp"
+
+#include <array>
+#include <cstdlib>  // getenv
+#include <fstream>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>  // move
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+#include "vamp/vamp.h"
+
+#include "DynamicLibrary.hpp"
+#include "LibraryProbe.hpp"
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+/* ---------------------------------------- Serialization --------------------------------------- */
+
+static constexpr std::array<char, 8> cacheMagic{'R', 'T', 'V', 'A', 'M', 'P', 'D', 'C'};
+static constexpr uint32_t            cacheVersion = 1;
+
+template <typename T>
+static void write(std::ostream& os, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT(*reinterpret-cast)
+}
+
+static void writeString(std::ostream& os, std::string_view str) {
+    write(os, static_cast<uint32_t>(str.size()));
+    os.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+template <typename T>
+static bool read(std::istream& is, T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));  // NOLINT(*reinterpret-cast)
+}
+
+// number of bytes left in the stream, to check sizes read from the file before allocating
+static uint64_t remaining(std::istream& is, uint64_t streamSize) {
+    const auto position = is.tellg();
+    if (position < 0 || static_cast<uint64_t>(position) > streamSize) {
+        return 0;
+    }
+    return streamSize - static_cast<uint64_t>(position);
+}
+
+static bool readString(std::istream& is, uint64_t streamSize, std::string& str) {
+    uint32_t size = 0;
+    if (!read(is, size) || size > remaining(is, streamSize)) {
+        return false;
+    }
+    str.resize(size);
+    return static_cast<bool>(is.read(str.data(), size));
+}
+
+/* ------------------------------------------- Probing ------------------------------------------ */
+
+static DiscoveryCache::PluginInfo convertPluginDescriptor(const VampPluginDescriptor& d) {
+    DiscoveryCache::PluginInfo info;
+    info.identifier     = helper::notNull(d.identifier);
+    info.name           = helper::notNull(d.name);
+    info.description    = helper::notNull(d.description);
+    info.maker          = helper::notNull(d.maker);
+    info.copyright      = helper::notNull(d.copyright);
+    info.pluginVersion  = d.pluginVersion;
+    info.vampApiVersion = d.vampApiVersion;
+    info.inputDomain    = d.inputDomain == vampFrequencyDomain
+        ? Plugin::InputDomain::Frequency
+        : Plugin::InputDomain::Time;
+    return info;
+}
+
+/* ---------------------------------------- DiscoveryCache -------------------------------------- */
+
+DiscoveryCache::DiscoveryCache(std::filesystem::path cacheFile) : cacheFile_(std::move(cacheFile)) {
+    if (!load()) {
+        entries_.clear();
+    }
+}
+
+std::filesystem::path DiscoveryCache::getDefaultCachePath() {
+    using std::filesystem::path;
+    const path filename("rtvamp-discovery.cache");
+
+    if (const char* customPath = std::getenv("RTVAMP_CACHE_PATH")) {
+        return customPath;
+    }
+#ifdef _WIN32
+    if (const char* localAppData = std::getenv("LOCALAPPDATA")) {
+        return path(localAppData) / "rtvamp" / filename;
+    }
+#elif __APPLE__
+    if (const char* home = std::getenv("HOME")) {
+        return path(home) / "Library/Caches/rtvamp" / filename;
+    }
+#else
+    if (const char* cacheHome = std::getenv("XDG_CACHE_HOME")) {
+        return path(cacheHome) / "rtvamp" / filename;
+    }
+    if (const char* home = std::getenv("HOME")) {
+        return path(home) / ".cache/rtvamp" / filename;
+    }
+#endif
+    std::error_code ec;
+    return std::filesystem::temp_directory_path(ec) / filename;
+}
+
+std::optional<DiscoveryCache::FileStamp> DiscoveryCache::stat(const std::filesystem::path& path) {
+#ifdef _WIN32
+    std::error_code ec;
+    const auto size  = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return FileStamp{
+        .mtime = static_cast<int64_t>(mtime.time_since_epoch().count()),
+        .size  = static_cast<uint64_t>(size),
+        .inode = 0,
+    };
+#else
+    struct ::stat st{};
+    if (::stat(path.c_str(), &st) != 0) {
+        return std::nullopt;
+    }
+#ifdef __APPLE__
+    const auto& mtime = st.st_mtimespec;
+#else
+    const auto& mtime = st.st_mtim;
+#endif
+    return FileStamp{
+        .mtime = static_cast<int64_t>(mtime.tv_sec) * 1'000'000'000 + static_cast<int64_t>(mtime.tv_nsec),
+        .size  = static_cast<uint64_t>(st.st_size),
+        .inode = static_cast<uint64_t>(st.st_ino),
+    };
+#endif
+}
+
+const DiscoveryCache::Entry* DiscoveryCache::lookup(const std::filesystem::path& libraryPath) {
+    const auto stamp = stat(libraryPath);
+    if (!stamp) {
+        return nullptr;
+    }
+
+    if (auto it = entries_.find(libraryPath); it != entries_.end() && it->second.stamp == *stamp) {
+        ++statistics_.hits;
+        it->second.lookedUp = true;
+        return &it->second;
+    }
+
+    ++statistics_.misses;
+    modified_ = true;
+
+    Entry entry;
+    entry.stamp    = *stamp;
+    entry.name     = libraryPath.stem().string();
+    entry.lookedUp = true;
+
+    if (const auto dl = openVampLibrary(libraryPath)) {
+        const auto func = dl->getFunction<VampGetPluginDescriptorFunction>("vampGetPluginDescriptor");
+        entry.isVampLibrary = true;
+        unsigned int i = 0;
+        while (const auto* descriptor = func(VAMP_API_VERSION, i++)) {
+            entry.plugins.push_back(convertPluginDescriptor(*descriptor));
+        }
+    }
+
+    return &(entries_[libraryPath] = std::move(entry));
+}
+
+std::optional<DiscoveryCache::LibraryInfo> DiscoveryCache::getLibraryInfo(
+    const std::filesystem::path& libraryPath
+) {
+    const auto* entry = lookup(libraryPath);
+    if (entry == nullptr || !entry->isVampLibrary) {
+        return std::nullopt;
+    }
+    return LibraryInfo{libraryPath, entry->name, entry->plugins};
+}
+
+std::vector<std::filesystem::path> DiscoveryCache::listLibraries(
+    std::span<const std::filesystem::path> paths
+) {
+    std::set<std::filesystem::path> result;  // use set to avoid duplicates (paths may have duplicates)
+    for (auto&& path : paths) {
+        std::error_code ec;  // for noexcept versions
+        if (!std::filesystem::is_directory(path, ec)) {
+            continue;
+        }
+        for (auto&& entry : std::filesystem::recursive_directory_iterator(path, ec)) {
+            if (!helper::isLibraryCandidate(entry)) {
+                continue;
+            }
+            const auto* cached = lookup(entry.path());
+            if (cached != nullptr && cached->isVampLibrary) {
+                result.insert(entry.path());
+            }
+        }
+    }
+    return {result.begin(), result.end()};
+}
+
+std::vector<PluginKey> DiscoveryCache::listPlugins(std::span<const std::filesystem::path> paths) {
+    std::set<PluginKey> result;  // use set to avoid duplicates (paths may have duplicates)
+    const auto insert = [&](const std::filesystem::path& libraryPath) {
+        const auto* entry = lookup(libraryPath);
+        if (entry == nullptr || !entry->isVampLibrary) {
+            return;
+        }
+        try {
+            std::vector<PluginKey> keys;
+            for (auto&& plugin : entry->plugins) {
+                keys.emplace_back(entry->name, plugin.identifier);
+            }
+            result.insert(keys.begin(), keys.end());
+        } catch (const std::invalid_argument&) {}  // NOLINT(*empty-catch)
+    };
+
+    for (auto&& path : paths) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(path, ec)) {
+            for (auto&& entry : std::filesystem::recursive_directory_iterator(path, ec)) {
+                if (helper::isLibraryCandidate(entry)) {
+                    insert(entry.path());
+                }
+            }
+        } else if (std::filesystem::is_regular_file(path, ec)) {
+            insert(path);
+        }
+    }
+    return {result.begin(), result.end()};
+}
+
+std::optional<std::filesystem::path> DiscoveryCache::findLibrary(std::string_view libraryName) const {
+    for (auto&& [path, entry] : entries_) {
+        if (entry.isVampLibrary && entry.name == libraryName) {
+            return path;
+        }
+    }
+    return std::nullopt;
+}
+
+void DiscoveryCache::clear() {
+    entries_.clear();
+    statistics_ = {};
+    modified_   = true;
+}
+
+bool DiscoveryCache::load() try {
+    if (cacheFile_.empty()) {
+        return true;
+    }
+    std::error_code ec;
+    const uint64_t  streamSize = std::filesystem::file_size(cacheFile_, ec);
+    if (ec) {
+        return false;
+    }
+    std::ifstream is(cacheFile_, std::ios::binary);
+    if (!is) {
+        return false;
+    }
+    const auto readStringChecked = [&](std::string& str) { return readString(is, streamSize, str); };
+
+    std::array<char, cacheMagic.size()> magic{};
+    uint32_t version = 0;
+    uint64_t count   = 0;
+    if (!is.read(magic.data(), magic.size()) || magic != cacheMagic) {
+        return false;
+    }
+    if (!read(is, version) || version != cacheVersion || !read(is, count)) {
+        return false;
+    }
+
+    for (uint64_t i = 0; i < count; ++i) {
+        std::string path;
+        Entry       entry;
+        uint8_t     isVampLibrary = 0;
+        uint32_t    pluginCount   = 0;
+        if (!readStringChecked(path) ||
+            !read(is, entry.stamp.mtime) ||
+            !read(is, entry.stamp.size) ||
+            !read(is, entry.stamp.inode) ||
+            !read(is, isVampLibrary) ||
+            !readStringChecked(entry.name) ||
+            !read(is, pluginCount)) {
+            return false;
+        }
+        // each plugin takes at least 5 string sizes, versions and input domain
+        constexpr uint64_t minPluginSize = 5 * sizeof(uint32_t) + sizeof(int) + sizeof(uint32_t) + 1;
+        if (pluginCount > remaining(is, streamSize) / minPluginSize) {
+            return false;
+        }
+        entry.isVampLibrary = isVampLibrary != 0;
+        entry.plugins.resize(pluginCount);
+        for (auto& plugin : entry.plugins) {
+            uint8_t inputDomain = 0;
+            if (!readStringChecked(plugin.identifier) ||
+                !readStringChecked(plugin.name) ||
+                !readStringChecked(plugin.description) ||
+                !readStringChecked(plugin.maker) ||
+                !readStringChecked(plugin.copyright) ||
+                !read(is, plugin.pluginVersion) ||
+                !read(is, plugin.vampApiVersion) ||
+                !read(is, inputDomain)) {
+                return false;
+            }
+            plugin.inputDomain = inputDomain != 0
+                ? Plugin::InputDomain::Frequency
+                : Plugin::InputDomain::Time;
+        }
+        entries_.insert_or_assign(std::filesystem::path(path), std::move(entry));
+    }
+    return true;
+} catch (...) {
+    return false;  // e.g. allocation failure, ignore invalid cache file
+}
+
+void DiscoveryCache::prune() {
+    std::erase_if(entries_, [&](const auto& item) {
+        const auto& [path, entry] = item;
+        if (entry.lookedUp) {
+            return false;  // stamp checked by lookup
+        }
+        const auto stamp = stat(path);
+        if (stamp && *stamp == entry.stamp) {
+            return false;
+        }
+        modified_ = true;
+        return true;  // library removed or modified
+    });
+}
+
+bool DiscoveryCache::save() {
+    prune();
+    if (cacheFile_.empty() || !modified_) {
+        return true;
+    }
+
+    std::error_code ec;
+    if (cacheFile_.has_parent_path()) {
+        std::filesystem::create_directories(cacheFile_.parent_path(), ec);
+    }
+
+    // write to temporary file and rename to replace the cache file atomically
+    auto tempFile = cacheFile_;
+    tempFile += helper::concat(".tmp", std::random_device{}());
+    {
+        std::ofstream os(tempFile, std::ios::binary | std::ios::trunc);
+        if (!os) {
+            return false;
+        }
+        os.write(cacheMagic.data(), cacheMagic.size());
+        write(os, cacheVersion);
+        write(os, static_cast<uint64_t>(entries_.size()));
+        for (auto&& [path, entry] : entries_) {
+            writeString(os, path.string());
+            write(os, entry.stamp.mtime);
+            write(os, entry.stamp.size);
+            write(os, entry.stamp.inode);
+            write(os, static_cast<uint8_t>(entry.isVampLibrary));
+            writeString(os, entry.name);
+            write(os, static_cast<uint32_t>(entry.plugins.size()));
+            for (auto&& plugin : entry.plugins) {
+                writeString(os, plugin.identifier);
+                writeString(os, plugin.name);
+                writeString(os, plugin.description);
+                writeString(os, plugin.maker);
+                writeString(os, plugin.copyright);
+                write(os, plugin.pluginVersion);
+                write(os, plugin.vampApiVersion);
+                write(os, static_cast<uint8_t>(plugin.inputDomain == Plugin::InputDomain::Frequency));
+            }
+        }
+        if (!os.flush()) {
+            std::filesystem::remove(tempFile, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempFile, cacheFile_, ec);
+    if (ec) {
+        std::filesystem::remove(tempFile, ec);
+        return false;
+    }
+    modified_ = false;
+    return true;
+}
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,101 @@
+#include "rtvamp/hostsdk/FFT.hpp"
+
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <numbers>
+#include <stdexcept>
+#include <utility>  // pair
+
+#include "FFTBackends.hpp"
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+AlignedVector<std::complex<float>> createSplitTwiddles(size_t size) {
+    AlignedVector<std::complex<float>> twiddles(size / 4 + 1);
+    for (size_t k = 0; k < twiddles.size(); ++k) {
+        // compute in double precision, otherwise the error grows with the FFT size
+        const double phase = -2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(size);
+        twiddles[k] = {static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase))};
+    }
+    return twiddles;
+}
+
+static std::span<const FFTBackend* const> getFFTBackends() {
+    static const FFTBackend* const backends[] = {  // NOLINT(*avoid-c-arrays)
+#ifdef RTVAMP_HAS_FFTW
+        &getFFTWBackend(),
+#endif
+#ifdef RTVAMP_HAS_KISSFFT
+        &getKissFFTBackend(),
+#endif
+        &getBuiltinFFTBackend(),
+    };
+    return backends;
+}
+
+std::vector<std::string_view> listFFTBackends() {
+    std::vector<std::string_view> result;
+    for (const auto* backend : getFFTBackends()) {
+        result.push_back(backend->getName());
+    }
+    return result;
+}
+
+const FFTBackend& getFFTBackend(std::string_view name) {
+    const auto backends = getFFTBackends();
+    if (name.empty()) {
+        return *backends.front();
+    }
+    for (const auto* backend : backends) {
+        if (backend->getName() == name) {
+            return *backend;
+        }
+    }
+    throw std::invalid_argument(helper::concat("FFT backend not available: ", name));
+}
+
+static std::shared_ptr<const FFTBackend::Plan> getPlan(const FFTBackend& backend, size_t size) {
+    static std::mutex mutex;
+    // weak references, plans are released if not used anymore
+    static std::map<std::pair<const FFTBackend*, size_t>, std::weak_ptr<const FFTBackend::Plan>> cache;
+
+    const std::lock_guard lock(mutex);
+    auto& entry = cache[{&backend, size}];
+    auto plan = entry.lock();
+    if (!plan) {
+        plan  = backend.createPlan(size);
+        entry = plan;
+    }
+    return plan;
+}
+
+FFT::FFT(size_t size, const FFTBackend& backend)
+    : size_(size),
+      backend_(&backend) {
+    if (size == 0) {
+        throw std::invalid_argument("FFT size must be greater than zero");
+    }
+    plan_ = getPlan(backend, size);
+    output_.resize(getBinCount());
+}
+
+Plugin::FrequencyDomainBuffer FFT::compute(std::span<const float> input) {
+    compute(input, output_);
+    return output_;
+}
+
+void FFT::compute(std::span<const float> input, std::span<std::complex<float>> output) const {
+    if (input.size() != size_ || output.size() != getBinCount()) {
+        throw std::invalid_argument(
+            helper::concat(
+                "Wrong FFT buffer size: input ", input.size(), " (expected: ", size_, "), ",
+                "output ", output.size(), " (expected: ", getBinCount(), ")"
+            )
+        );
+    }
+    plan_->compute(input, output);
+}
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,202 @@
+#include <algorithm>  // fill_n
+#include <bit>  // bit_ceil, countr_zero, has_single_bit
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include "FFTBackends.hpp"
+
+namespace rtvamp::hostsdk {
+
+static std::complex<float> twiddle(size_t k, size_t size) {
+    // compute in double precision, otherwise the error grows with the FFT size
+    const double phase = -2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(size);
+    return {static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase))};
+}
+
+/**
+ * Butterfly stages of a complex radix-2 FFT for power of two sizes.
+ *
+ * The input is reordered by the caller (bit reversed indices of getBitReversed) and transformed
+ * in-place. The twiddle factors of each stage are stored contiguously, so the inner butterfly
+ * loop has unit stride and can be vectorised.
+ */
+class Radix2Transform {
+public:
+    explicit Radix2Transform(size_t size) : bitReversed_(size), stageTwiddles_(size) {
+        const int bits = std::countr_zero(size);
+        for (size_t i = 0; i < size; ++i) {
+            size_t reversed = 0;
+            for (int bit = 0; bit < bits; ++bit) {
+                reversed |= ((i >> bit) & 1U) << (bits - 1 - bit);
+            }
+            bitReversed_[i] = static_cast<uint32_t>(reversed);
+        }
+        // stage with butterfly distance m uses m twiddles, stored at offset m - 1
+        for (size_t m = 1; m < size; m *= 2) {
+            for (size_t k = 0; k < m; ++k) {
+                stageTwiddles_[m - 1 + k] = twiddle(k, 2 * m);
+            }
+        }
+    }
+
+    size_t   getSize() const noexcept { return bitReversed_.size(); }
+    uint32_t getBitReversed(size_t i) const noexcept { return bitReversed_[i]; }
+
+    void compute(std::complex<float>* z) const noexcept {
+        const size_t size = getSize();
+        // NOLINTBEGIN(*pointer-arithmetic)
+        for (size_t m = 1; m < size; m *= 2) {
+            const auto* w = stageTwiddles_.data() + m - 1;
+            for (size_t start = 0; start < size; start += 2 * m) {
+                auto* lo = z + start;
+                auto* hi = z + start + m;
+                for (size_t k = 0; k < m; ++k) {
+                    // hi * w without the complex multiplication of std::complex (NaN checks)
+                    const float tRe = hi[k].real() * w[k].real() - hi[k].imag() * w[k].imag();
+                    const float tIm = hi[k].real() * w[k].imag() + hi[k].imag() * w[k].real();
+                    const auto  a   = lo[k];
+                    lo[k] = {a.real() + tRe, a.imag() + tIm};
+                    hi[k] = {a.real() - tRe, a.imag() - tIm};
+                }
+            }
+        }
+        // NOLINTEND(*pointer-arithmetic)
+    }
+
+private:
+    std::vector<uint32_t>              bitReversed_;
+    AlignedVector<std::complex<float>> stageTwiddles_;
+};
+
+/**
+ * Radix-2 FFT for power of two sizes.
+ *
+ * The real input is packed as complex values and transformed with a complex FFT of half size
+ * directly in the output buffer, followed by splitRealSpectrum.
+ */
+class Radix2Plan final : public FFTBackend::Plan {
+public:
+    explicit Radix2Plan(size_t size) : transform_(size / 2), splitTwiddles_(createSplitTwiddles(size)) {}
+
+    void compute(std::span<const float> input, std::span<std::complex<float>> output) const override {
+        const size_t half = transform_.getSize();
+        auto*        z    = output.data();
+
+        // pack even samples as real and odd samples as imaginary part, in bit reversed order
+        for (size_t i = 0; i < half; ++i) {
+            z[transform_.getBitReversed(i)] = {input[2 * i], input[2 * i + 1]};  // NOLINT(*pointer-arithmetic)
+        }
+        transform_.compute(z);
+        splitRealSpectrum(output, splitTwiddles_);
+    }
+
+private:
+    Radix2Transform                    transform_;
+    AlignedVector<std::complex<float>> splitTwiddles_;
+};
+
+/**
+ * Bluestein FFT for sizes other than powers of two, O(size log size).
+ *
+ * The DFT of size n is expressed as convolution with a chirp, computed with radix-2 FFTs of size
+ * m >= 2n - 1. Even sizes are packed as complex values of half size (like Radix2Plan), odd sizes
+ * are transformed as complex values with zero imaginary parts.
+ * The work buffer is allocated per thread on the first call (and grows for larger sizes).
+ */
+class BluesteinPlan final : public FFTBackend::Plan {
+public:
+    explicit BluesteinPlan(size_t size)
+        : packed_(size % 2 == 0),
+          n_(packed_ ? size / 2 : size),
+          transform_(std::bit_ceil(2 * n_ - 1)),
+          chirp_(n_),
+          kernel_(transform_.getSize()) {
+        // chirp w[j] = exp(-i pi j^2 / n), j^2 modulo 2n to keep the phase exact
+        for (size_t j = 0; j < n_; ++j) {
+            const auto jj = static_cast<uint64_t>(j) * j % (2 * n_);
+            chirp_[j]     = twiddle(jj, 2 * n_);
+        }
+        // FFT of the conjugated chirp b[j] = b[m - j] = conj(w[j]), scaled for the inverse FFT
+        const size_t m     = transform_.getSize();
+        const float  scale = 1.0F / static_cast<float>(m);
+        for (size_t j = 0; j < n_; ++j) {
+            const auto b = std::conj(chirp_[j]) * scale;
+            kernel_[transform_.getBitReversed(j)] = b;
+            if (j > 0) {
+                kernel_[transform_.getBitReversed(m - j)] = b;
+            }
+        }
+        transform_.compute(kernel_.data());
+        if (packed_) {
+            splitTwiddles_ = createSplitTwiddles(size);
+        }
+    }
+
+    void compute(std::span<const float> input, std::span<std::complex<float>> output) const override {
+        const size_t m = transform_.getSize();
+        thread_local AlignedVector<std::complex<float>> work;
+        if (work.size() < 2 * m) {
+            work.resize(2 * m);
+        }
+        auto* a = work.data();
+        auto* y = work.data() + m;  // NOLINT(*pointer-arithmetic)
+
+        // a[j] = x[j] * w[j], zero-padded to m, in bit reversed order
+        std::fill_n(a, m, std::complex<float>{});
+        for (size_t j = 0; j < n_; ++j) {
+            const std::complex<float> x = packed_
+                ? std::complex<float>{input[2 * j], input[2 * j + 1]}
+                : std::complex<float>{input[j], 0.0F};
+            a[transform_.getBitReversed(j)] = multiply(x, chirp_[j]);  // NOLINT(*pointer-arithmetic)
+        }
+        transform_.compute(a);
+
+        // convolution with the chirp: inverse FFT as conj(FFT(conj(A * B)))
+        for (size_t k = 0; k < m; ++k) {
+            y[transform_.getBitReversed(k)] = std::conj(multiply(a[k], kernel_[k]));  // NOLINT(*pointer-arithmetic)
+        }
+        transform_.compute(y);
+
+        const size_t bins = packed_ ? n_ : output.size();
+        for (size_t k = 0; k < bins; ++k) {
+            output[k] = multiply(std::conj(y[k]), chirp_[k]);  // NOLINT(*pointer-arithmetic)
+        }
+        if (packed_) {
+            splitRealSpectrum(output, splitTwiddles_);
+        }
+    }
+
+private:
+    // without the complex multiplication of std::complex (NaN checks)
+    static std::complex<float> multiply(std::complex<float> a, std::complex<float> b) noexcept {
+        return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+    }
+
+    bool                               packed_;
+    size_t                             n_;  ///< size of the complex DFT
+    Radix2Transform                    transform_;
+    AlignedVector<std::complex<float>> chirp_;
+    AlignedVector<std::complex<float>> kernel_;  ///< FFT of the conjugated chirp
+    AlignedVector<std::complex<float>> splitTwiddles_;
+};
+
+class BuiltinFFTBackend final : public FFTBackend {
+public:
+    std::string_view getName() const noexcept override { return "builtin"; }
+
+    std::unique_ptr<Plan> createPlan(size_t size) const override {
+        if (size >= 2 && std::has_single_bit(size)) {
+            return std::make_unique<Radix2Plan>(size);
+        }
+        return std::make_unique<BluesteinPlan>(size);
+    }
+};
+
+const FFTBackend& getBuiltinFFTBackend() {
+    static const BuiltinFFTBackend backend;
+    return backend;
+}
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,72 @@
+#include <mutex>
+
+#include <fftw3.h>
+
+#include "FFTBackends.hpp"
+
+namespace rtvamp::hostsdk {
+
+// only the execute functions of FFTW are thread-safe, not the planner
+static std::mutex& getPlannerMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/**
+ * Real-to-complex plan of FFTW (single precision).
+ *
+ * Planned with FFTW_UNALIGNED to accept any input and output buffers with the new-array execute
+ * function, which is thread-safe.
+ */
+class FFTWPlan final : public FFTBackend::Plan {
+public:
+    explicit FFTWPlan(size_t size) {
+        AlignedVector<float>               input(size);
+        AlignedVector<std::complex<float>> output(size / 2 + 1);
+        const std::lock_guard lock(getPlannerMutex());
+        plan_ = fftwf_plan_dft_r2c_1d(
+            static_cast<int>(size),
+            input.data(),
+            reinterpret_cast<fftwf_complex*>(output.data()),  // NOLINT(*reinterpret-cast)
+            FFTW_ESTIMATE | FFTW_UNALIGNED
+        );
+    }
+
+    FFTWPlan(const FFTWPlan&) = delete;
+    FFTWPlan(FFTWPlan&&) = delete;
+    FFTWPlan& operator=(const FFTWPlan&) = delete;
+    FFTWPlan& operator=(FFTWPlan&&) = delete;
+
+    ~FFTWPlan() override {
+        const std::lock_guard lock(getPlannerMutex());
+        fftwf_destroy_plan(plan_);
+    }
+
+    void compute(std::span<const float> input, std::span<std::complex<float>> output) const override {
+        // input is not modified by out-of-place real-to-complex transforms
+        fftwf_execute_dft_r2c(
+            plan_,
+            const_cast<float*>(input.data()),  // NOLINT(*const-cast)
+            reinterpret_cast<fftwf_complex*>(output.data())  // NOLINT(*reinterpret-cast)
+        );
+    }
+
+private:
+    fftwf_plan plan_{nullptr};
+};
+
+class FFTWBackend final : public FFTBackend {
+public:
+    std::string_view getName() const noexcept override { return "fftw"; }
+
+    std::unique_ptr<Plan> createPlan(size_t size) const override {
+        return std::make_unique<FFTWPlan>(size);
+    }
+};
+
+const FFTBackend& getFFTWBackend() {
+    static const FFTWBackend backend;
+    return backend;
+}
+
+}  // namespace rtvamp::hostsdk
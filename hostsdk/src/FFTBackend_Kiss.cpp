@@ -0,0 +1,67 @@
+#include <type_traits>
+
+#include <kissfft/kiss_fft.h>
+
+#include "FFTBackends.hpp"
+
+namespace rtvamp::hostsdk {
+
+// make sure the Kiss FFT type can be casted to std::complex<float>
+static_assert(std::is_standard_layout_v<kiss_fft_cpx>);
+static_assert(std::is_same_v<decltype(kiss_fft_cpx::r), float>);
+static_assert(std::is_same_v<decltype(kiss_fft_cpx::i), float>);
+static_assert(sizeof(kiss_fft_cpx) == sizeof(std::complex<float>));
+
+/**
+ * Mixed radix FFT of Kiss FFT for even sizes.
+ *
+ * The real input is transformed as complex input of half size (out-of-place, thread-safe and
+ * without the scratch buffer of `kiss_fftr`) directly into the output buffer.
+ */
+class KissPlan final : public FFTBackend::Plan {
+public:
+    explicit KissPlan(size_t size)
+        : config_(kiss_fft_alloc(static_cast<int>(size / 2), 0, nullptr, nullptr)),
+          splitTwiddles_(createSplitTwiddles(size)) {}
+
+    KissPlan(const KissPlan&) = delete;
+    KissPlan(KissPlan&&) = delete;
+    KissPlan& operator=(const KissPlan&) = delete;
+    KissPlan& operator=(KissPlan&&) = delete;
+
+    ~KissPlan() override {
+        kiss_fft_free(config_);
+    }
+
+    void compute(std::span<const float> input, std::span<std::complex<float>> output) const override {
+        kiss_fft(
+            config_,
+            reinterpret_cast<const kiss_fft_cpx*>(input.data()),  // NOLINT(*reinterpret-cast)
+            reinterpret_cast<kiss_fft_cpx*>(output.data())  // NOLINT(*reinterpret-cast)
+        );
+        splitRealSpectrum(output, splitTwiddles_);
+    }
+
+private:
+    kiss_fft_cfg                       config_;
+    AlignedVector<std::complex<float>> splitTwiddles_;
+};
+
+class KissFFTBackend final : public FFTBackend {
+public:
+    std::string_view getName() const noexcept override { return "kissfft"; }
+
+    std::unique_ptr<Plan> createPlan(size_t size) const override {
+        if (size % 2 != 0) {
+            return getBuiltinFFTBackend().createPlan(size);
+        }
+        return std::make_unique<KissPlan>(size);
+    }
+};
+
+const FFTBackend& getKissFFTBackend() {
+    static const KissFFTBackend backend;
+    return backend;
+}
+
+}  // namespace rtvamp::hostsdk
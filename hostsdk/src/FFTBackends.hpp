@@ -0,0 +1,57 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <span>
+
+#include "rtvamp/hostsdk/AlignedAllocator.hpp"
+#include "rtvamp/hostsdk/FFT.hpp"
+
+namespace rtvamp::hostsdk {
+
+const FFTBackend& getBuiltinFFTBackend();
+#ifdef RTVAMP_HAS_FFTW
+const FFTBackend& getFFTWBackend();
+#endif
+#ifdef RTVAMP_HAS_KISSFFT
+const FFTBackend& getKissFFTBackend();
+#endif
+
+/**
+ * Twiddle factors exp(-2 pi i k / size) for k <= size / 4, used by splitRealSpectrum.
+ */
+AlignedVector<std::complex<float>> createSplitTwiddles(size_t size);
+
+/**
+ * Convert the complex FFT (half size) of the real input, packed as complex values (even samples
+ * as real, odd samples as imaginary parts), to the spectrum of the real input (in-place).
+ * @param spectrum Complex FFT in the first `size / 2` bins, spectrum with `size / 2 + 1` bins afterwards
+ * @param twiddles Twiddle factors of createSplitTwiddles
+ */
+inline void splitRealSpectrum(
+    std::span<std::complex<float>> spectrum, std::span<const std::complex<float>> twiddles
+) noexcept {
+    const size_t half = spectrum.size() - 1;
+    const auto   z0   = spectrum[0];
+    // bins k and half - k are computed from the same pair of values:
+    // X[k] = E + W^k * O, X[half - k] = conj(E - W^k * O)
+    for (size_t k = 1; k <= half / 2; ++k) {
+        const auto a = spectrum[k];
+        const auto b = std::conj(spectrum[half - k]);
+        const auto w = twiddles[k];
+        // E = (a + b) / 2, O = -i / 2 * (a - b)
+        const float eRe = 0.5F * (a.real() + b.real());
+        const float eIm = 0.5F * (a.imag() + b.imag());
+        const float oRe = 0.5F * (a.imag() - b.imag());
+        const float oIm = -0.5F * (a.real() - b.real());
+        // W^k * O without the complex multiplication of std::complex (NaN checks)
+        const float woRe = w.real() * oRe - w.imag() * oIm;
+        const float woIm = w.real() * oIm + w.imag() * oRe;
+        spectrum[k]        = {eRe + woRe, eIm + woIm};
+        spectrum[half - k] = {eRe - woRe, -(eIm - woIm)};
+    }
+    spectrum[0]    = {z0.real() + z0.imag(), 0.0F};
+    spectrum[half] = {z0.real() - z0.imag(), 0.0F};
+}
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,372 @@
+#include "rtvamp/hostsdk/FeatureFile.hpp"
+
+#include <algorithm>  // equal, fill_n
+#include <array>
+#include <bit>  // endian
+#include <cstddef>
+#include <cstring>  // memcpy
+#include <limits>
+#include <numeric>  // accumulate
+#include <stdexcept>
+#include <utility>  // move
+
+#include "MappedFile.hpp"
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+namespace {
+
+constexpr size_t fixedHeaderSize  = 64;
+constexpr size_t outputHeaderSize = 4 * sizeof(uint32_t) + sizeof(uint64_t);
+constexpr size_t dataAlignment    = 64;
+
+// offsets within the fixed header
+constexpr size_t offsetVersion      = 8;
+constexpr size_t offsetDataOffset   = 12;
+constexpr size_t offsetSampleRate   = 16;
+constexpr size_t offsetStepSize     = 20;
+constexpr size_t offsetBlockSize    = 24;
+constexpr size_t offsetOutputCount  = 28;
+constexpr size_t offsetRowCount     = 32;
+constexpr size_t offsetPluginKeySize = 40;
+
+constexpr uint64_t alignUp(uint64_t value) noexcept {
+    return (value + dataAlignment - 1) / dataAlignment * dataAlignment;
+}
+
+void checkLittleEndian() {
+    if constexpr (std::endian::native != std::endian::little) {
+        throw std::runtime_error("Feature files are only supported on little-endian platforms");
+    }
+}
+
+template <typename T>
+void store(std::vector<std::byte>& buffer, size_t offset, T value) {
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));  // NOLINT(*pointer-arithmetic)
+}
+
+template <typename T>
+void append(std::vector<std::byte>& buffer, T value) {
+    buffer.resize(buffer.size() + sizeof(T));
+    store(buffer, buffer.size() - sizeof(T), value);
+}
+
+void append(std::vector<std::byte>& buffer, std::string_view str) {
+    const auto* data = reinterpret_cast<const std::byte*>(str.data());  // NOLINT(*reinterpret-cast)
+    buffer.insert(buffer.end(), data, data + str.size());  // NOLINT(*pointer-arithmetic)
+}
+
+}  // namespace
+
+/* -------------------------------------- FeatureFileWriter ------------------------------------- */
+
+FeatureFileWriter::FeatureFileWriter(
+    const std::filesystem::path& path,
+    std::string_view             pluginKey,
+    Plugin::OutputList           outputs,
+    float                        sampleRate,
+    uint32_t                     stepSize,
+    uint32_t                     blockSize
+)
+    : pluginKey_(pluginKey),
+      sampleRate_(sampleRate),
+      stepSize_(stepSize),
+      blockSize_(blockSize) {
+    checkLittleEndian();
+    for (const auto& output : outputs) {
+        if (!output.hasFixedBinCount) {
+            throw std::invalid_argument(
+                helper::concat("Output \"", output.identifier, "\" has no fixed bin count")
+            );
+        }
+    }
+
+    file_.reset(std::fopen(path.string().c_str(), "wb"));  // NOLINT(*owning-memory)
+    if (!file_) {
+        throw std::runtime_error(helper::concat("Failed to create feature file ", path));
+    }
+
+    columns_.reserve(outputs.size());
+    for (const auto& output : outputs) {
+        FilePtr buffer(std::tmpfile());  // NOLINT(*owning-memory)
+        if (!buffer) {
+            throw std::runtime_error("Failed to create temporary file");
+        }
+        std::setvbuf(buffer.get(), nullptr, _IOFBF, 1 << 16);
+        columns_.push_back({output.identifier, output.name, output.unit, output.binCount, std::move(buffer)});
+    }
+}
+
+FeatureFileWriter::FeatureFileWriter(FeatureFileWriter&&) noexcept = default;
+
+FeatureFileWriter& FeatureFileWriter::operator=(FeatureFileWriter&& other) noexcept {
+    if (this != &other) {
+        // complete the current file first, otherwise it would be left without header
+        try {
+            close();
+        } catch (...) {}  // NOLINT(*empty-catch)
+        file_       = std::move(other.file_);
+        pluginKey_  = std::move(other.pluginKey_);
+        sampleRate_ = other.sampleRate_;
+        stepSize_   = other.stepSize_;
+        blockSize_  = other.blockSize_;
+        columns_    = std::move(other.columns_);
+        rowCount_   = other.rowCount_;
+    }
+    return *this;
+}
+
+FeatureFileWriter::~FeatureFileWriter() {
+    try {
+        close();
+    } catch (...) {}  // NOLINT(*empty-catch)
+}
+
+void FeatureFileWriter::checkOpen() const {
+    if (!file_) {
+        throw std::logic_error("Feature file is closed");
+    }
+}
+
+void FeatureFileWriter::append(Column& column, const float* values, size_t count) {
+    if (std::fwrite(values, sizeof(float), count, column.buffer.get()) != count) {
+        throw std::runtime_error("Failed to write features to temporary file");
+    }
+}
+
+template <typename Set>
+void FeatureFileWriter::writeSet(const Set& features) {
+    checkOpen();
+    if (features.size() != columns_.size()) {
+        throw std::invalid_argument(
+            helper::concat("Feature set size must match output count (", columns_.size(), ")")
+        );
+    }
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        if (features[i].size() != columns_[i].binCount) {
+            throw std::invalid_argument(
+                helper::concat(
+                    "Feature value count of output ", i, " does not match bin count: ",
+                    features[i].size(), " != ", columns_[i].binCount
+                )
+            );
+        }
+    }
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        append(columns_[i], features[i].data(), features[i].size());
+    }
+    ++rowCount_;
+}
+
+void FeatureFileWriter::write(Plugin::FeatureSet features) {
+    writeSet(features);
+}
+
+void FeatureFileWriter::write(Plugin::FeatureViewSet features) {
+    writeSet(features);
+}
+
+void FeatureFileWriter::writeMatrix(std::span<const float> features) {
+    checkOpen();
+    const size_t rowSize = std::accumulate(
+        columns_.begin(), columns_.end(), size_t{0}, [](size_t sum, const Column& column) {
+            return sum + column.binCount;
+        }
+    );
+    if (features.empty()) {
+        return;
+    }
+    if (rowSize == 0 || features.size() % rowSize != 0) {
+        throw std::invalid_argument(
+            helper::concat("Feature matrix size must be a multiple of the row size (", rowSize, ")")
+        );
+    }
+    const size_t rows = features.size() / rowSize;
+    for (size_t row = 0; row < rows; ++row) {
+        const float* values = features.data() + row * rowSize;  // NOLINT(*pointer-arithmetic)
+        for (auto& column : columns_) {
+            append(column, values, column.binCount);
+            values += column.binCount;  // NOLINT(*pointer-arithmetic)
+        }
+    }
+    rowCount_ += rows;
+}
+
+void FeatureFileWriter::close() {
+    if (!file_) {
+        return;
+    }
+    // close the file in any case, a failed file is not completed
+    const FilePtr file   = std::move(file_);
+    const auto    fail   = [] { throw std::runtime_error("Failed to write feature file"); };
+
+    // data offsets
+    uint64_t headerSize = fixedHeaderSize + pluginKey_.size();
+    for (const auto& column : columns_) {
+        headerSize += outputHeaderSize + column.identifier.size() + column.name.size() + column.unit.size();
+    }
+    std::vector<uint64_t> offsets;
+    uint64_t              offset = alignUp(headerSize);
+    for (const auto& column : columns_) {
+        offsets.push_back(offset);
+        offset = alignUp(offset + rowCount_ * column.binCount * sizeof(float));
+    }
+    const uint64_t dataOffset = offsets.empty() ? alignUp(headerSize) : offsets.front();
+    if (dataOffset > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("Feature file header too large");
+    }
+
+    // header
+    std::vector<std::byte> header(fixedHeaderSize);
+    std::memcpy(header.data(), featurefile::magic, sizeof(featurefile::magic));
+    store(header, offsetVersion, featurefile::version);
+    store(header, offsetDataOffset, static_cast<uint32_t>(dataOffset));
+    store(header, offsetSampleRate, sampleRate_);
+    store(header, offsetStepSize, stepSize_);
+    store(header, offsetBlockSize, blockSize_);
+    store(header, offsetOutputCount, static_cast<uint32_t>(columns_.size()));
+    store(header, offsetRowCount, rowCount_);
+    store(header, offsetPluginKeySize, static_cast<uint32_t>(pluginKey_.size()));
+    rtvamp::hostsdk::append(header, std::string_view(pluginKey_));
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        const auto& column = columns_[i];
+        rtvamp::hostsdk::append(header, column.binCount);
+        rtvamp::hostsdk::append(header, static_cast<uint32_t>(column.identifier.size()));
+        rtvamp::hostsdk::append(header, static_cast<uint32_t>(column.name.size()));
+        rtvamp::hostsdk::append(header, static_cast<uint32_t>(column.unit.size()));
+        rtvamp::hostsdk::append(header, offsets[i]);
+        rtvamp::hostsdk::append(header, std::string_view(column.identifier));
+        rtvamp::hostsdk::append(header, std::string_view(column.name));
+        rtvamp::hostsdk::append(header, std::string_view(column.unit));
+    }
+    if (std::fwrite(header.data(), 1, header.size(), file.get()) != header.size()) {
+        fail();
+    }
+
+    // copy the features of each output from the temporary files
+    std::vector<std::byte> chunk(1 << 20);
+    uint64_t               position = header.size();
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        std::fill_n(chunk.begin(), offsets[i] - position, std::byte{0});  // padding < alignment
+        if (std::fwrite(chunk.data(), 1, offsets[i] - position, file.get()) != offsets[i] - position) {
+            fail();
+        }
+        position = offsets[i];
+
+        std::FILE* buffer = columns_[i].buffer.get();
+        if (std::fflush(buffer) != 0 || std::fseek(buffer, 0, SEEK_SET) != 0) {
+            fail();
+        }
+        size_t count = 0;
+        while ((count = std::fread(chunk.data(), 1, chunk.size(), buffer)) > 0) {
+            if (std::fwrite(chunk.data(), 1, count, file.get()) != count) {
+                fail();
+            }
+            position += count;
+        }
+        if (std::ferror(buffer) != 0) {
+            fail();
+        }
+        columns_[i].buffer.reset();  // release temporary file
+    }
+    if (std::fflush(file.get()) != 0) {
+        fail();
+    }
+}
+
+/* -------------------------------------- FeatureFileReader ------------------------------------- */
+
+FeatureFileReader::FeatureFileReader(const std::filesystem::path& path)
+    : file_(std::make_unique<MappedFile>(path)) {
+    checkLittleEndian();
+
+    const auto data    = file_->data();
+    const auto invalid = [&](std::string_view reason) {
+        return std::runtime_error(helper::concat("Invalid feature file ", path, ": ", reason));
+    };
+    const auto read = [&]<typename T>(size_t offset, T& value) {
+        if (offset > data.size() || data.size() - offset < sizeof(T)) {
+            throw invalid("unexpected end of header");
+        }
+        std::memcpy(&value, data.data() + offset, sizeof(T));  // NOLINT(*pointer-arithmetic)
+    };
+    const auto readString = [&](size_t offset, size_t size) {
+        if (offset > data.size() || data.size() - offset < size) {
+            throw invalid("unexpected end of header");
+        }
+        return std::string(reinterpret_cast<const char*>(data.data() + offset), size);  // NOLINT
+    };
+
+    std::array<char, sizeof(featurefile::magic)> magic{};
+    read(0, magic);
+    if (!std::equal(magic.begin(), magic.end(), std::begin(featurefile::magic))) {
+        throw invalid("wrong magic number");
+    }
+    uint32_t version = 0;
+    read(offsetVersion, version);
+    if (version != featurefile::version) {
+        throw invalid(helper::concat("unsupported version ", version));
+    }
+
+    uint32_t outputCount   = 0;
+    uint32_t pluginKeySize = 0;
+    read(offsetSampleRate, sampleRate_);
+    read(offsetStepSize, stepSize_);
+    read(offsetBlockSize, blockSize_);
+    read(offsetOutputCount, outputCount);
+    read(offsetRowCount, rowCount_);
+    read(offsetPluginKeySize, pluginKeySize);
+
+    size_t cursor = fixedHeaderSize;
+    pluginKey_ = readString(cursor, pluginKeySize);
+    cursor += pluginKeySize;
+
+    for (uint32_t i = 0; i < outputCount; ++i) {
+        Output   output;
+        uint32_t identifierSize = 0;
+        uint32_t nameSize       = 0;
+        uint32_t unitSize       = 0;
+        uint64_t offset         = 0;
+        read(cursor, output.binCount);
+        read(cursor + 4, identifierSize);
+        read(cursor + 8, nameSize);
+        read(cursor + 12, unitSize);
+        read(cursor + 16, offset);
+        cursor += outputHeaderSize;
+        output.identifier = readString(cursor, identifierSize);
+        cursor += identifierSize;
+        output.name = readString(cursor, nameSize);
+        cursor += nameSize;
+        output.unit = readString(cursor, unitSize);
+        cursor += unitSize;
+
+        // bounds of the feature data (without overflow)
+        const uint64_t maxValues = data.size() / sizeof(float);
+        if (output.binCount != 0 && rowCount_ > maxValues / output.binCount) {
+            throw invalid(helper::concat("features of output ", i, " exceed the file size"));
+        }
+        const uint64_t size = rowCount_ * output.binCount * sizeof(float);
+        if (offset % sizeof(float) != 0 || offset > data.size() || data.size() - offset < size) {
+            throw invalid(helper::concat("features of output ", i, " exceed the file size"));
+        }
+
+        const auto* values = reinterpret_cast<const float*>(data.data() + offset);  // NOLINT
+        features_.emplace_back(values, static_cast<size_t>(rowCount_ * output.binCount));
+        outputs_.push_back(std::move(output));
+    }
+}
+
+FeatureFileReader::FeatureFileReader(FeatureFileReader&&) noexcept = default;
+FeatureFileReader& FeatureFileReader::operator=(FeatureFileReader&&) noexcept = default;
+FeatureFileReader::~FeatureFileReader() = default;
+
+std::span<const float> FeatureFileReader::getFeatures(size_t outputIndex) const {
+    return features_.at(outputIndex);
+}
+
+uint64_t FeatureFileReader::getTimestamp(uint64_t row) const noexcept {
+    return helper::getTimestamp(row * stepSize_, sampleRate_);
+}
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,172 @@
+#include "LibraryProbe.hpp"
+
+#include <algorithm>  // find
+#include <array>
+#include <bit>  // endian
+#include <cstring>  // memcmp
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if __has_include(<elf.h>)
+#include <elf.h>
+#define RTVAMP_HAS_ELF
+#endif
+
+#include "vamp/vamp.h"
+
+#include "DynamicLibrary.hpp"
+
+namespace rtvamp::hostsdk {
+
+#ifdef RTVAMP_HAS_ELF
+
+template <typename T>
+static bool readAt(std::ifstream& file, uint64_t offset, T* data, size_t count = 1) {
+    file.seekg(static_cast<std::streamoff>(offset));
+    // NOLINTNEXTLINE(*reinterpret-cast)
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(sizeof(T) * count)));
+}
+
+// check if the range [offset, offset + size) lies within the file (without overflow)
+static bool isInFile(uint64_t offset, uint64_t size, uint64_t fileSize) noexcept {
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+template <typename Ehdr, typename Shdr, typename Sym>
+static std::optional<bool> hasDynamicSymbolImpl(std::ifstream& file, uint64_t fileSize, std::string_view symbol) {
+    Ehdr header{};
+    if (!readAt(file, 0, &header)) {
+        return std::nullopt;
+    }
+    if (header.e_type != ET_DYN) {
+        return false;  // no shared object
+    }
+    if (header.e_shoff == 0 || header.e_shentsize != sizeof(Shdr)) {
+        return std::nullopt;  // no section headers
+    }
+
+    uint64_t sectionCount = header.e_shnum;
+    if (sectionCount == 0) {
+        // extended numbering: number of sections stored in first section header
+        Shdr first{};
+        if (!readAt(file, header.e_shoff, &first)) {
+            return std::nullopt;
+        }
+        sectionCount = first.sh_size;
+    }
+    constexpr uint64_t maxSectionCount = 1 << 16;
+    if (sectionCount == 0 || sectionCount > maxSectionCount ||
+        !isInFile(header.e_shoff, sectionCount * sizeof(Shdr), fileSize)) {
+        return std::nullopt;
+    }
+
+    std::vector<Shdr> sections(sectionCount);
+    if (!readAt(file, header.e_shoff, sections.data(), sections.size())) {
+        return std::nullopt;
+    }
+
+    for (const auto& section : sections) {
+        if (section.sh_type != SHT_DYNSYM) {
+            continue;
+        }
+        if (section.sh_entsize != sizeof(Sym) || section.sh_link >= sections.size()) {
+            return std::nullopt;
+        }
+        const auto& stringSection = sections[section.sh_link];
+        // sizes are read from the file, check them before allocating
+        if (!isInFile(section.sh_offset, section.sh_size, fileSize) ||
+            !isInFile(stringSection.sh_offset, stringSection.sh_size, fileSize)) {
+            return std::nullopt;
+        }
+
+        std::vector<Sym>  symbols(section.sh_size / sizeof(Sym));
+        std::vector<char> strings(stringSection.sh_size);
+        if (!readAt(file, section.sh_offset, symbols.data(), symbols.size()) ||
+            !readAt(file, stringSection.sh_offset, strings.data(), strings.size())) {
+            return std::nullopt;
+        }
+
+        for (const auto& sym : symbols) {
+            if (sym.st_shndx == SHN_UNDEF || sym.st_name >= strings.size()) {
+                continue;  // imported symbol
+            }
+            const auto binding = sym.st_info >> 4U;  // ELF32_ST_BIND == ELF64_ST_BIND
+            if (binding != STB_GLOBAL && binding != STB_WEAK) {
+                continue;
+            }
+            const auto first = strings.begin() + sym.st_name;
+            const std::string_view name(&*first, std::find(first, strings.end(), '\0') - first);
+            if (name == symbol) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return std::nullopt;  // no dynamic symbol table found
+}
+
+std::optional<bool> hasDynamicSymbol(const std::filesystem::path& libraryPath, std::string_view symbol) {
+    std::error_code ec;
+    const auto      fileSize = std::filesystem::file_size(libraryPath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    std::ifstream file(libraryPath, std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+
+    std::array<unsigned char, EI_NIDENT> ident{};
+    if (!readAt(file, 0, ident.data(), ident.size())) {
+        return std::nullopt;
+    }
+    if (std::memcmp(ident.data(), ELFMAG, SELFMAG) != 0) {
+        return std::nullopt;  // no ELF file
+    }
+
+    constexpr auto hostDataEncoding = std::endian::native == std::endian::little ? ELFDATA2LSB : ELFDATA2MSB;
+    if (ident[EI_DATA] != hostDataEncoding) {
+        return std::nullopt;
+    }
+
+    switch (ident[EI_CLASS]) {
+    case ELFCLASS32:
+        return hasDynamicSymbolImpl<Elf32_Ehdr, Elf32_Shdr, Elf32_Sym>(file, fileSize, symbol);
+    case ELFCLASS64:
+        return hasDynamicSymbolImpl<Elf64_Ehdr, Elf64_Shdr, Elf64_Sym>(file, fileSize, symbol);
+    default:
+        return std::nullopt;
+    }
+}
+
+#else
+
+std::optional<bool> hasDynamicSymbol(const std::filesystem::path& /* libraryPath */, std::string_view /* symbol */) {
+    return std::nullopt;
+}
+
+#endif
+
+std::shared_ptr<DynamicLibrary> openVampLibrary(const std::filesystem::path& libraryPath) noexcept {
+    constexpr const char* symbol = "vampGetPluginDescriptor";
+
+    try {
+        if (const auto found = hasDynamicSymbol(libraryPath, symbol); found && !found.value()) {
+            return nullptr;  // rejected by pre-filter, no need to load the library
+        }
+
+        auto dl = std::make_shared<DynamicLibrary>();
+        if (!dl->load(libraryPath)) {
+            return nullptr;
+        }
+        if (dl->getFunction<VampGetPluginDescriptorFunction>(symbol) == nullptr) {
+            return nullptr;
+        }
+        return dl;
+    } catch (...) {
+        return nullptr;  // e.g. allocation failure, treated as invalid library
+    }
+}
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace rtvamp::hostsdk {
+
+class DynamicLibrary;
+
+/**
+ * Check if an ELF shared object defines (exports) a dynamic symbol.
+ *
+ * Only the ELF header, section headers and the dynamic symbol table are read from the file. The
+ * library is not loaded, therefore no library constructors are run and no relocations resolved.
+ *
+ * @return `std::nullopt` if the file can not be parsed (e.g. non-ELF platforms, missing section
+ *         headers), the caller must then fall back to load the library
+ */
+std::optional<bool> hasDynamicSymbol(const std::filesystem::path& libraryPath, std::string_view symbol);
+
+/**
+ * Open a Vamp library with a single load.
+ *
+ * Libraries without an exported `vampGetPluginDescriptor` symbol are rejected by the ELF
+ * pre-filter (if available) before loading. The returned handle can be passed to PluginLibrary.
+ *
+ * @return Loaded library or `nullptr` if the path is not a valid Vamp library (never throws)
+ */
+std::shared_ptr<DynamicLibrary> openVampLibrary(const std::filesystem::path& libraryPath) noexcept;
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <utility>  // swap
+
+namespace rtvamp::hostsdk {
+
+/**
+ * Read-only memory mapping of a whole file.
+ *
+ * References:
+ * - https://man7.org/linux/man-pages/man2/mmap.2.html
+ * - https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffile
+ */
+class MappedFile {
+public:
+    /**
+     * Map the file into memory.
+     * @throw std::runtime_error if the file could not be opened or mapped
+     */
+    explicit MappedFile(const std::filesystem::path& path) { mapImpl(path); }
+
+    ~MappedFile() { unmapImpl(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { swap(other); }
+    MappedFile& operator=(MappedFile&& other) noexcept { swap(other); return *this; }
+
+    /** Mapped file content (valid as long as the object exists). */
+    std::span<const std::byte> data() const noexcept {
+        return {static_cast<const std::byte*>(data_), size_};
+    }
+
+    void swap(MappedFile& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    // platform specific implementations
+    void mapImpl(const std::filesystem::path& path);
+    void unmapImpl() noexcept;
+
+    const void* data_{nullptr};
+    size_t      size_{0};
+};
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,49 @@
+#include "MappedFile.hpp"
+
+#include <cerrno>
+#include <cstring>  // strerror
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+void MappedFile::mapImpl(const std::filesystem::path& path) {
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT(*vararg)
+    if (fd < 0) {
+        throw std::runtime_error(helper::concat("Failed to open file ", path, ": ", std::strerror(errno)));
+    }
+    const helper::ScopeExit closeFile([fd]() noexcept { close(fd); });
+
+    struct stat info{};
+    if (fstat(fd, &info) != 0) {
+        throw std::runtime_error(helper::concat("Failed to get size of file ", path, ": ", std::strerror(errno)));
+    }
+    if (info.st_size == 0) {
+        return;  // empty files can not be mapped
+    }
+
+    const auto size = static_cast<size_t>(info.st_size);
+    void*      data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {  // NOLINT(*cstyle-cast, *int-to-ptr)
+        throw std::runtime_error(helper::concat("Failed to map file ", path, ": ", std::strerror(errno)));
+    }
+    data_ = data;
+    size_ = size;
+}
+
+void MappedFile::unmapImpl() noexcept {
+    if (data_ == nullptr) {
+        return;
+    }
+    munmap(const_cast<void*>(data_), size_);  // NOLINT(*const-cast)
+    data_ = nullptr;
+    size_ = 0;
+}
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,57 @@
+#include "MappedFile.hpp"
+
+#include <stdexcept>
+
+#include <Windows.h>
+
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+void MappedFile::mapImpl(const std::filesystem::path& path) {
+    HANDLE file = CreateFileW(
+        path.wstring().c_str(),  // unicode support
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error(helper::concat("Failed to open file ", path, " (error ", GetLastError(), ")"));
+    }
+    const helper::ScopeExit closeFile([file]() noexcept { CloseHandle(file); });
+
+    LARGE_INTEGER size{};
+    if (GetFileSizeEx(file, &size) == 0) {
+        throw std::runtime_error(helper::concat("Failed to get size of file ", path, " (error ", GetLastError(), ")"));
+    }
+    if (size.QuadPart == 0) {
+        return;  // empty files can not be mapped
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        throw std::runtime_error(helper::concat("Failed to map file ", path, " (error ", GetLastError(), ")"));
+    }
+    const helper::ScopeExit closeMapping([mapping]() noexcept { CloseHandle(mapping); });  // view keeps mapping alive
+
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr) {
+        throw std::runtime_error(helper::concat("Failed to map file ", path, " (error ", GetLastError(), ")"));
+    }
+    data_ = data;
+    size_ = static_cast<size_t>(size.QuadPart);
+}
+
+void MappedFile::unmapImpl() noexcept {
+    if (data_ == nullptr) {
+        return;
+    }
+    UnmapViewOfFile(data_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+}  // namespace rtvamp::hostsdk
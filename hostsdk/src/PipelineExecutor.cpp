@@ -0,0 +1,156 @@
+#include "rtvamp/hostsdk/PipelineExecutor.hpp"
+
+#include <algorithm>  // any_of, fill, max, min
+#include <stdexcept>
+#include <utility>  // move
+
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+static size_t getEffectiveThreadCount(unsigned int threads, size_t pluginCount) {
+    if (threads == 0) {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    return std::max<size_t>(std::min<size_t>(threads, pluginCount), 1);
+}
+
+PipelineExecutor::PipelineExecutor(std::vector<std::unique_ptr<Plugin>> plugins, unsigned int threads)
+    : plugins_(std::move(plugins)),
+      features_(plugins_.size()),
+      ranges_(getEffectiveThreadCount(threads, plugins_.size())) {
+    for (const auto& plugin : plugins_) {
+        if (plugin == nullptr) {
+            throw std::invalid_argument("Plugin is null");
+        }
+        isTimeDomain_.push_back(plugin->getInputDomain() == Plugin::InputDomain::Time);
+    }
+
+    // contiguous ranges of plugins for each thread
+    const size_t threadCount = ranges_.size();
+    for (size_t i = 0; i < threadCount; ++i) {
+        ranges_[i].end = plugins_.size() * (i + 1) / threadCount;
+    }
+
+    workers_.reserve(threadCount - 1);
+    try {
+        for (size_t worker = 1; worker < threadCount; ++worker) {
+            workers_.emplace_back([this, worker](std::stop_token stopToken) { workerLoop(stopToken, worker); });
+        }
+    } catch (...) {
+        stopWorkers();  // the destructor is not called, joining waiting workers would deadlock
+        throw;
+    }
+}
+
+PipelineExecutor::~PipelineExecutor() {
+    stopWorkers();
+}
+
+void PipelineExecutor::stopWorkers() noexcept {
+    for (auto& worker : workers_) {
+        worker.request_stop();
+    }
+    epoch_.fetch_add(1, std::memory_order_release);
+    epoch_.notify_all();
+    workers_.clear();  // join
+}
+
+void PipelineExecutor::initialise(
+    uint32_t stepSize, uint32_t blockSize, uint32_t channelCount, WindowType windowType
+) {
+    initialised_ = false;
+    for (const auto& plugin : plugins_) {
+        if (!plugin->initialise(stepSize, blockSize, channelCount)) {
+            throw std::runtime_error(
+                helper::concat("Initialisation of plugin \"", plugin->getIdentifier(), "\" failed")
+            );
+        }
+    }
+    spectralFrontEnd_.reset();
+    if (std::any_of(isTimeDomain_.begin(), isTimeDomain_.end(), [](bool isTime) { return !isTime; })) {
+        spectralFrontEnd_.emplace(blockSize, channelCount, windowType);
+    }
+    std::fill(features_.begin(), features_.end(), Plugin::FeatureSet{});
+    initialised_ = true;
+}
+
+void PipelineExecutor::reset() {
+    for (const auto& plugin : plugins_) {
+        plugin->reset();
+    }
+    std::fill(features_.begin(), features_.end(), Plugin::FeatureSet{});
+}
+
+std::span<const Plugin::FeatureSet> PipelineExecutor::process(const Plugin::InputBuffer& buffer, uint64_t nsec) {
+    if (!initialised_) {
+        throw std::logic_error("Pipeline must be initialised before process");
+    }
+
+    input_    = buffer;
+    spectrum_ = spectralFrontEnd_ ? spectralFrontEnd_->compute(buffer) : Plugin::InputBuffer{};
+    nsec_     = nsec;
+    size_t begin = 0;
+    for (auto& range : ranges_) {
+        range.next.store(begin, std::memory_order_relaxed);
+        begin = range.end;
+    }
+
+    // publish the block to the workers
+    remaining_.store(workers_.size(), std::memory_order_relaxed);
+    epoch_.fetch_add(1, std::memory_order_release);
+    epoch_.notify_all();
+
+    runTasks(0);
+
+    // barrier: wait until all workers finished the block
+    for (size_t remaining = remaining_.load(std::memory_order_acquire); remaining != 0;
+         remaining = remaining_.load(std::memory_order_acquire)) {
+        remaining_.wait(remaining, std::memory_order_acquire);
+    }
+
+    if (exception_) {
+        std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+    return features_;
+}
+
+void PipelineExecutor::workerLoop(std::stop_token stopToken, size_t worker) {
+    uint64_t epoch = 0;  // workers are started before the first block is published
+    while (true) {
+        epoch_.wait(epoch, std::memory_order_acquire);
+        epoch = epoch_.load(std::memory_order_acquire);
+        if (stopToken.stop_requested()) {
+            return;
+        }
+        runTasks(worker);
+        if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            remaining_.notify_one();
+        }
+    }
+}
+
+void PipelineExecutor::runTasks(size_t worker) {
+    // own range first, then steal from the ranges of the other threads
+    const size_t threadCount = ranges_.size();
+    for (size_t k = 0; k < threadCount; ++k) {
+        auto& range = ranges_[(worker + k) % threadCount];
+        for (size_t i = range.next.fetch_add(1, std::memory_order_relaxed); i < range.end;
+             i = range.next.fetch_add(1, std::memory_order_relaxed)) {
+            runPlugin(i);
+        }
+    }
+}
+
+void PipelineExecutor::runPlugin(size_t index) {
+    try {
+        features_[index] = plugins_[index]->process(isTimeDomain_[index] ? input_ : spectrum_, nsec_);
+    } catch (...) {
+        const std::lock_guard lock(exceptionMutex_);
+        if (!exception_) {
+            exception_ = std::current_exception();
+        }
+    }
+}
+
+}  // namespace rtvamp::hostsdk
@@ -1,23 +1,27 @@
 #include "rtvamp/hostsdk/PluginHostAdapter.hpp"
 
-#include <algorithm>  // copy_n
+#include <algorithm>  // copy_n, find_if, is_sorted, max, minmax_element
 #include <cassert>
+#include <cmath>  // llround
+#include <complex>
+#include <cstring>  // strlen
+#include <numeric>  // accumulate
 #include <optional>
 #include <stdexcept>
 #include <string>
-#include <utility>  // move
+#include <type_traits>
+#include <utility>  // move, pair
+#include <variant>
 
 #include "vamp/vamp.h"
 
+#include "rtvamp/pluginsdk/detail/Extension.hpp"
+
 #include "DynamicLibrary.hpp"
 #include "helper.hpp"
 
 namespace rtvamp::hostsdk {
 
-inline static const char* notNull(const char* str) {
-    return str != nullptr ? str : "";
-}
-
 template <typename T>
 inline static std::optional<T> createOptional(T value, bool hasValue) {
     return hasValue ? std::make_optional(value) : std::nullopt;
@@ -32,10 +36,10 @@ static std::vector<Plugin::ParameterDescriptor> convertParameterDescriptors(
         const auto* vampParameter = descriptor.parameters[i];  // NOLINT(*pointer-arithmetic)
         auto& parameter     = result[i];
 
-        parameter.identifier   = notNull(vampParameter->identifier);
-        parameter.name         = notNull(vampParameter->name);
-        parameter.description  = notNull(vampParameter->description);
-        parameter.unit         = notNull(vampParameter->unit);
+        parameter.identifier   = helper::notNull(vampParameter->identifier);
+        parameter.name         = helper::notNull(vampParameter->name);
+        parameter.description  = helper::notNull(vampParameter->description);
+        parameter.unit         = helper::notNull(vampParameter->unit);
         parameter.defaultValue = vampParameter->defaultValue;
         parameter.minValue     = vampParameter->minValue;
         parameter.maxValue     = vampParameter->maxValue;
@@ -84,6 +88,17 @@ inline static std::optional<int> findProgramIndex(
     return {};
 }
 
+static Plugin::SampleType convertSampleType(VampSampleType sampleType) noexcept {
+    switch (sampleType) {
+    case vampFixedSampleRate:
+        return Plugin::SampleType::FixedSampleRate;
+    case vampVariableSampleRate:
+        return Plugin::SampleType::VariableSampleRate;
+    default:
+        return Plugin::SampleType::OneSamplePerStep;
+    }
+}
+
 static void checkPluginDescriptor(const VampPluginDescriptor& d) {
     using Error = std::runtime_error;
 
@@ -143,6 +158,23 @@ static void checkPluginDescriptor(const VampPluginDescriptor& d) {
     }
 }
 
+static const RtvampPluginExtension* findExtension(
+    const VampPluginDescriptor& descriptor, DynamicLibrary* library
+) {
+    if (library == nullptr) {
+        return nullptr;
+    }
+    const auto func = library->getFunction<RtvampGetPluginExtensionFunction>("rtvampGetPluginExtension");
+    if (func == nullptr) {
+        return nullptr;
+    }
+    const auto* extension = func(RTVAMP_EXTENSION_ABI_VERSION, &descriptor);
+    if (extension == nullptr || extension->abiVersion < 1 || extension->process == nullptr) {
+        return nullptr;
+    }
+    return extension;
+}
+
 PluginHostAdapter::PluginHostAdapter(
     const VampPluginDescriptor&     descriptor,
     float                           inputSampleRate,
@@ -158,6 +190,7 @@ PluginHostAdapter::PluginHostAdapter(
 
     parameters_ = convertParameterDescriptors(descriptor_);
     programs_   = convertPrograms(descriptor_);
+    extension_  = findExtension(descriptor_, library_.get());
 
     try {
         checkRequirements();
@@ -168,6 +201,7 @@ PluginHostAdapter::PluginHostAdapter(
 }
 
 PluginHostAdapter::~PluginHostAdapter() {
+    releasePendingFeatureSet();
     descriptor_.cleanup(handle_);
 }
 
@@ -183,23 +217,23 @@ uint32_t PluginHostAdapter::getVampApiVersion() const noexcept {
 }
 
 std::string_view PluginHostAdapter::getIdentifier() const noexcept {
-    return notNull(descriptor_.identifier);
+    return helper::notNull(descriptor_.identifier);
 }
 
 std::string_view PluginHostAdapter::getName() const noexcept {
-    return notNull(descriptor_.name);
+    return helper::notNull(descriptor_.name);
 }
 
 std::string_view PluginHostAdapter::getDescription() const noexcept {
-    return notNull(descriptor_.description);
+    return helper::notNull(descriptor_.description);
 }
 
 std::string_view PluginHostAdapter::getMaker() const noexcept {
-    return notNull(descriptor_.maker);
+    return helper::notNull(descriptor_.maker);
 }
 
 std::string_view PluginHostAdapter::getCopyright() const noexcept {
-    return notNull(descriptor_.copyright);
+    return helper::notNull(descriptor_.copyright);
 }
 int PluginHostAdapter::getPluginVersion() const noexcept {
     return descriptor_.pluginVersion;
@@ -229,6 +263,53 @@ bool PluginHostAdapter::setParameter(std::string_view id, float value) {
         return false;
     }
     descriptor_.setParameter(handle_, optionalIndex.value(), value);
+    refreshOutputDescriptors();  // outputs might depend on parameters
+    return true;
+}
+
+void PluginHostAdapter::scheduleParameterEvents(ParameterEventList events) {
+    const bool sorted = std::is_sorted(
+        events.begin(),
+        events.end(),
+        [](const auto& a, const auto& b) { return a.offset < b.offset; }
+    );
+    if (!sorted) {
+        throw std::invalid_argument("Parameter events must be sorted by offset");
+    }
+    for (const auto& event : events) {
+        if (event.parameter.index >= descriptor_.parameterCount) {
+            throw std::invalid_argument(
+                helper::concat("Invalid parameter handle: index ", event.parameter.index)
+            );
+        }
+    }
+    parameterEvents_.clear();  // keeps capacity
+    for (const auto& event : events) {
+        parameterEvents_.push_back({event.offset, event.parameter.index, event.value});
+    }
+}
+
+std::optional<Plugin::ParameterHandle> PluginHostAdapter::resolveParameter(std::string_view id) const {
+    const auto optionalIndex = findParameterIndex(descriptor_, id);
+    if (!optionalIndex) {
+        return {};
+    }
+    return ParameterHandle{static_cast<uint32_t>(optionalIndex.value())};
+}
+
+std::optional<float> PluginHostAdapter::getParameter(ParameterHandle handle) const {
+    if (handle.index >= descriptor_.parameterCount) {
+        return {};
+    }
+    return descriptor_.getParameter(handle_, static_cast<int>(handle.index));
+}
+
+bool PluginHostAdapter::setParameter(ParameterHandle handle, float value) {
+    if (handle.index >= descriptor_.parameterCount) {
+        return false;
+    }
+    descriptor_.setParameter(handle_, static_cast<int>(handle.index), value);
+    refreshOutputDescriptors();  // outputs might depend on parameters
     return true;
 }
 
@@ -251,6 +332,7 @@ bool PluginHostAdapter::selectProgram(std::string_view name) {
         return false;
     }
     descriptor_.selectProgram(handle_, optionalIndex.value());
+    refreshOutputDescriptors();  // outputs might depend on program
     return true;
 }
 
@@ -267,23 +349,37 @@ uint32_t PluginHostAdapter::getOutputCount() const {
 }
 
 Plugin::OutputList PluginHostAdapter::getOutputDescriptors() const {
+    return outputDescriptors_;
+}
+
+void PluginHostAdapter::refreshOutputDescriptors() {
+    if (!initialised_) {  // output layout is fixed after initialise
+        updateOutputDescriptors();
+    }
+}
+
+void PluginHostAdapter::updateOutputDescriptors() {
     const auto outputCount = getOutputCount();
-    std::vector<OutputDescriptor> outputs(outputCount);
+    outputDescriptors_.resize(outputCount);  // reuse existing strings and vectors
 
     for (uint32_t i = 0; i < outputCount; ++i) {
-        auto& output     = outputs[i];
+        auto& output     = outputDescriptors_[i];
         auto* vampOutput = descriptor_.getOutputDescriptor(handle_, static_cast<int>(i));
 
         if (vampOutput == nullptr) {
             throw std::runtime_error(helper::concat("Output descriptor ", i, " is null"));
         }
+        const helper::ScopeExit deleter([&] {
+            descriptor_.releaseOutputDescriptor(vampOutput);
+        });
 
-        output.identifier  = vampOutput->identifier;
-        output.name        = vampOutput->name;
-        output.description = vampOutput->description;
-        output.unit        = vampOutput->unit;
+        output.identifier  = helper::notNull(vampOutput->identifier);
+        output.name        = helper::notNull(vampOutput->name);
+        output.description = helper::notNull(vampOutput->description);
+        output.unit        = helper::notNull(vampOutput->unit);
 
         output.binCount = vampOutput->binCount;
+        output.binNames.clear();
         if (vampOutput->hasFixedBinCount != 0 && vampOutput->binNames != nullptr) {
             bool validBinNames = false;
             output.binNames.resize(output.binCount);
@@ -303,28 +399,182 @@ Plugin::OutputList PluginHostAdapter::getOutputDescriptors() const {
         output.maxValue        = vampOutput->maxValue;
         output.quantizeStep    = createOptional(vampOutput->quantizeStep, vampOutput->isQuantized == 1);
 
-        descriptor_.releaseOutputDescriptor(vampOutput);
+        output.hasFixedBinCount = vampOutput->hasFixedBinCount == 1;
+        output.sampleType       = convertSampleType(vampOutput->sampleType);
+        output.sampleRate       = vampOutput->sampleRate;
+        output.hasDuration      = descriptor_.vampApiVersion >= 2 && vampOutput->hasDuration == 1;
     }
+}
+
+// some plugins report 0 channels, which was accepted as one channel before the channel count check
+uint32_t PluginHostAdapter::getMinChannelCount() const {
+    return std::max(descriptor_.getMinChannelCount(handle_), 1U);
+}
 
-    return outputs;
+uint32_t PluginHostAdapter::getMaxChannelCount() const {
+    return std::max(descriptor_.getMaxChannelCount(handle_), 1U);
 }
 
-bool PluginHostAdapter::initialise(uint32_t stepSize, uint32_t blockSize) {
+bool PluginHostAdapter::isStateless() const {
+    return extension_ != nullptr && extension_->abiVersion >= 3 && extension_->stateless != 0;
+}
+
+uint32_t PluginHostAdapter::getWarmUpLength() const {
+    if (extension_ == nullptr || extension_->abiVersion < 3 || extension_->stateless != 0) {
+        return 0;
+    }
+    return extension_->warmUpLength;
+}
+
+bool PluginHostAdapter::initialise(uint32_t stepSize, uint32_t blockSize, uint32_t channelCount) {
+    const auto minChannelCount = getMinChannelCount();
+    const auto maxChannelCount = getMaxChannelCount();
+    if (channelCount < minChannelCount || channelCount > maxChannelCount) {
+        throw std::invalid_argument(
+            helper::concat(
+                "Invalid channel count: ", channelCount, " (supported: ", minChannelCount, " - ",
+                maxChannelCount, ")"
+            )
+        );
+    }
+
+    releasePendingFeatureSet();
+    parameterEvents_.clear();
     outputCount_ = getOutputCount();
     if (featureSet_.size() != outputCount_) {
         featureSet_.resize(outputCount_);
     }
-    initialised_ = descriptor_.initialise(handle_, 1, stepSize, blockSize) != 0;
-    initialisedBlockSize_ = blockSize;
+    if (featureViews_.size() != outputCount_) {
+        featureViews_.resize(outputCount_);
+    }
+    inputBuffers_.resize(channelCount);
+    initialised_ = descriptor_.initialise(handle_, channelCount, stepSize, blockSize) != 0;
+    initialisedBlockSize_    = blockSize;
+    initialisedChannelCount_ = channelCount;
     checkRequirements();  // output definitions might change dynamically
+
+    const auto descriptors = getOutputDescriptors();  // updated by checkRequirements
+    outputs_.resize(outputCount_);
+    oneSamplePerStep_ = true;
+    for (uint32_t i = 0; i < outputCount_; ++i) {
+        const auto& descriptor = descriptors[i];
+        auto&       output     = outputs_[i];
+        output.identifier       = descriptor.identifier;
+        output.binCount         = descriptor.binCount;
+        output.hasFixedBinCount = descriptor.hasFixedBinCount;
+        output.sampleType       = descriptor.sampleType;
+        output.sampleRate       = descriptor.sampleRate;
+
+        oneSamplePerStep_ = oneSamplePerStep_ &&
+            output.hasFixedBinCount &&
+            output.sampleType == SampleType::OneSamplePerStep;
+    }
+
+    eventArenas_.resize(outputCount_);
+    eventLists_.resize(outputCount_);
+
+    // allocate storage upfront, process must not allocate for outputs with one feature per block
+    for (uint32_t i = 0; i < outputCount_; ++i) {
+        const auto& output = outputs_[i];
+        auto&       arena  = eventArenas_[i];
+        arena.clear();
+        arena.nextTimestamp.reset();
+        if (output.hasFixedBinCount) {
+            featureSet_[i].resize(output.binCount);
+            arena.values.reserve(output.binCount);
+            arena.events.reserve(1);
+        }
+    }
     return initialised_;
 }
 
 void PluginHostAdapter::reset() {
+    releasePendingFeatureSet();
+    parameterEvents_.clear();
+    for (auto& arena : eventArenas_) {
+        arena.nextTimestamp.reset();
+    }
     descriptor_.reset(handle_);
 }
 
-Plugin::FeatureSet PluginHostAdapter::process(InputBuffer buffer, uint64_t nsec) {
+template <typename T>
+inline constexpr bool isMultiChannel =
+    std::is_same_v<T, Plugin::TimeDomainChannels> || std::is_same_v<T, Plugin::FrequencyDomainChannels>;
+
+inline static const float* toFloatPointer(const float* data) noexcept {
+    return data;
+}
+
+inline static const float* toFloatPointer(const std::complex<float>* data) noexcept {
+    // casts between interleaved arrays and std::complex are guaranteed to be valid
+    // https://en.cppreference.com/w/cpp/numeric/complex
+    // NOLINTNEXTLINE(*reinterpret-cast)
+    return reinterpret_cast<const float*>(data);
+}
+
+static bool isTimeDomainBuffer(const Plugin::InputBuffer& buffer) noexcept {
+    return std::holds_alternative<Plugin::TimeDomainBuffer>(buffer) ||
+        std::holds_alternative<Plugin::TimeDomainChannels>(buffer);
+}
+
+static size_t getChannelCount(const Plugin::InputBuffer& buffer) noexcept {
+    return std::visit(
+        [](auto&& buf) -> size_t {
+            if constexpr (isMultiChannel<std::decay_t<decltype(buf)>>) {
+                return buf.size();
+            } else {
+                return 1;
+            }
+        },
+        buffer
+    );
+}
+
+/** Minimum and maximum buffer size of all channels. */
+static std::pair<size_t, size_t> getInputSizeRange(const Plugin::InputBuffer& buffer) noexcept {
+    return std::visit(
+        [](auto&& buf) -> std::pair<size_t, size_t> {
+            if constexpr (isMultiChannel<std::decay_t<decltype(buf)>>) {
+                if (buf.empty()) {
+                    return {0, 0};
+                }
+                const auto [min, max] = std::minmax_element(
+                    buf.begin(), buf.end(), [](auto&& a, auto&& b) { return a.size() < b.size(); }
+                );
+                return {min->size(), max->size()};
+            } else {
+                return {buf.size(), buf.size()};
+            }
+        },
+        buffer
+    );
+}
+
+/**
+ * Get the single feature of a OneSamplePerStep output.
+ * The feature list is provided by the plugin, an empty list (e.g. after a plugin error) is not
+ * dereferenced.
+ */
+static const VampFeature& getSingleFeature(const VampFeatureList& vampFeatureList, size_t outputIndex) {
+    if (vampFeatureList.featureCount != 1 || vampFeatureList.features == nullptr) {
+        throw std::runtime_error(
+            helper::concat(
+                "Feature count of output ", outputIndex, " must be 1, but is ",
+                vampFeatureList.featureCount
+            )
+        );
+    }
+    return vampFeatureList.features[0].v1;  // NOLINT(*pointer-arithmetic)
+}
+
+static void assignFeature(Plugin::Feature& feature, const float* values, size_t valueCount) {
+    if (feature.size() != valueCount) {
+        feature.resize(valueCount);
+    }
+    std::copy_n(values, valueCount, feature.begin());
+}
+
+void PluginHostAdapter::checkInitialised() const {
 #ifdef RTVAMP_VALIDATE
     if (!initialised_) {
         throw std::logic_error("Plugin must be initialised before process");
@@ -332,9 +582,34 @@ Plugin::FeatureSet PluginHostAdapter::process(InputBuffer buffer, uint64_t nsec)
 #else
     assert(initialised_ && "Plugin must be initialised before process");
 #endif
+}
 
+void PluginHostAdapter::checkOneSamplePerStep() const {
+    if (oneSamplePerStep_) {
+        return;
+    }
+    for (auto&& output : outputs_) {
+        if (!output.hasFixedBinCount) {
+            throw std::logic_error(
+                helper::concat(
+                    "Dynamic bin count of output \"", output.identifier, "\" requires processEvents"
+                )
+            );
+        }
+        if (output.sampleType != SampleType::OneSamplePerStep) {
+            throw std::logic_error(
+                helper::concat(
+                    "Sample type of output \"", output.identifier, "\" requires processEvents ",
+                    "(OneSamplePerStep required)"
+                )
+            );
+        }
+    }
+}
+
+void PluginHostAdapter::checkInputBuffer(const InputBuffer& buffer) const {
     const bool isTimeDomain = getInputDomain() == InputDomain::Time;
-    const bool validType    = std::holds_alternative<TimeDomainBuffer>(buffer) == isTimeDomain;
+    const bool validType    = isTimeDomainBuffer(buffer) == isTimeDomain;
 
     if (!validType && isTimeDomain) {
         throw std::invalid_argument("Wrong input buffer type: Time domain required");
@@ -343,12 +618,24 @@ Plugin::FeatureSet PluginHostAdapter::process(InputBuffer buffer, uint64_t nsec)
         throw std::invalid_argument("Wrong input buffer type: Frequency domain required");
     }
 
+    const auto channelCount = getChannelCount(buffer);
+    if (channelCount != initialisedChannelCount_) {
+        throw std::invalid_argument(
+            helper::concat(
+                "Wrong input buffer channel count: Channel count must match initialised channel count of ",
+                initialisedChannelCount_
+            )
+        );
+    }
+}
+
+void PluginHostAdapter::checkInputBlockSize([[maybe_unused]] const InputBuffer& buffer) const {
 #ifdef RTVAMP_VALIDATE
-    const auto blockSize         = std::visit([] (auto&& buf) { return buf.size(); }, buffer);
-    const auto expectedBlockSize = isTimeDomain
+    const auto expectedBlockSize = getInputDomain() == InputDomain::Time
         ? initialisedBlockSize_
         : initialisedBlockSize_ / 2 + 1;
-    if (blockSize != expectedBlockSize) {
+    const auto [minBlockSize, maxBlockSize] = getInputSizeRange(buffer);
+    if (minBlockSize != expectedBlockSize || maxBlockSize != expectedBlockSize) {
         throw std::invalid_argument(
             helper::concat(
                 "Wrong input buffer size: Buffer size must match initialised block size of ",
@@ -357,90 +644,352 @@ Plugin::FeatureSet PluginHostAdapter::process(InputBuffer buffer, uint64_t nsec)
         );
     }
 #endif
+}
 
-    const auto getInputBuffer = [&] {
-        return isTimeDomain ?
-            std::get<TimeDomainBuffer>(buffer).data() :
-            // casts between interleaved arrays and std::complex are guaranteed to be valid
-            // https://en.cppreference.com/w/cpp/numeric/complex
-            // NOLINTNEXTLINE(*reinterpret-cast)
-            reinterpret_cast<const float*>(std::get<FrequencyDomainBuffer>(buffer).data());
-    };
-
-    const float* const  inputBuffer  = getInputBuffer();
-    const float* const* inputBuffers = &inputBuffer;
+const float* const* PluginHostAdapter::getInputBuffers(const InputBuffer& buffer, size_t offset) {
+    std::visit(
+        [&](auto&& buf) {
+            // NOLINTBEGIN(*pointer-arithmetic)
+            if constexpr (isMultiChannel<std::decay_t<decltype(buf)>>) {
+                for (size_t i = 0; i < buf.size(); ++i) {
+                    inputBuffers_[i] = toFloatPointer(buf[i].data() + offset);
+                }
+            } else {
+                inputBuffers_[0] = toFloatPointer(buf.data() + offset);
+            }
+            // NOLINTEND(*pointer-arithmetic)
+        },
+        buffer
+    );
+    return inputBuffers_.data();
+}
 
+VampFeatureList* PluginHostAdapter::callProcess(const float* const* inputBuffers, uint64_t nsec) {
+    applyParameterEvents(true);
     auto* vampFeatureLists = descriptor_.process(
         handle_,
         inputBuffers,
         static_cast<int>(nsec / 1'000'000'000),
         static_cast<int>(nsec % 1'000'000'000)
     );
+    applyParameterEvents(false);
 
     if (vampFeatureLists == nullptr) {
         throw std::runtime_error("Returned feature list is null");
     }
+    return vampFeatureLists;
+}
 
-    for (size_t i = 0; i < outputCount_; ++i) {
-        // NOLINTBEGIN(*pointer-arithmetic)
-        const auto& vampFeatureList = vampFeatureLists[i];
-        const auto& vampFeatureV1   = vampFeatureList.features[0].v1;
-        auto&       feature         = featureSet_[i];
-        // NOLINTEND(*pointer-arithmetic)
+const RtvampFeature* PluginHostAdapter::callProcessExtension(
+    const float* const* inputBuffers, uint64_t nsec
+) {
+    const RtvampFeature* features = nullptr;
+    if (parameterEvents_.empty()) {
+        features = extension_->process(handle_, inputBuffers, nsec);
+    } else if (extension_->abiVersion >= 2 && extension_->processWithParameterEvents != nullptr) {
+        features = extension_->processWithParameterEvents(
+            handle_,
+            inputBuffers,
+            nsec,
+            parameterEvents_.data(),
+            static_cast<unsigned int>(parameterEvents_.size())
+        );
+        parameterEvents_.clear();
+    } else {
+        applyParameterEvents(true);
+        features = extension_->process(handle_, inputBuffers, nsec);
+        applyParameterEvents(false);
+    }
+    if (features == nullptr) {
+        throw std::runtime_error("Returned feature set is null");
+    }
+    return features;
+}
 
-        assert(vampFeatureList.featureCount == 1);
+void PluginHostAdapter::applyParameterEvents(bool blockStart) {
+    // Vamp C API: apply events at block start (offset 0) before and all others after the block
+    if (parameterEvents_.empty()) {
+        return;
+    }
+    const auto end = blockStart
+        ? std::find_if(
+              parameterEvents_.begin(),
+              parameterEvents_.end(),
+              [](const auto& event) { return event.offset > 0; }
+          )
+        : parameterEvents_.end();
+    for (auto it = parameterEvents_.begin(); it != end; ++it) {
+        descriptor_.setParameter(handle_, static_cast<int>(it->parameterIndex), it->value);
+    }
+    parameterEvents_.erase(parameterEvents_.begin(), end);
+}
 
-        if (feature.size() != vampFeatureV1.valueCount) {
-            feature.resize(vampFeatureV1.valueCount);
+void PluginHostAdapter::releasePendingFeatureSet() {
+    if (pendingFeatureLists_ != nullptr) {
+        descriptor_.releaseFeatureSet(pendingFeatureLists_);
+        pendingFeatureLists_ = nullptr;
+    }
+}
+
+Plugin::FeatureSet PluginHostAdapter::process(InputBuffer buffer, uint64_t nsec) {
+    checkInitialised();
+    checkOneSamplePerStep();
+    checkInputBuffer(buffer);
+    checkInputBlockSize(buffer);
+    releasePendingFeatureSet();
+    lastTimestamp_ = nsec;
+
+    if (extension_ != nullptr) {
+        const auto* features = callProcessExtension(getInputBuffers(buffer), nsec);
+        for (size_t i = 0; i < outputCount_; ++i) {
+            // NOLINTNEXTLINE(*pointer-arithmetic)
+            assignFeature(featureSet_[i], features[i].values, features[i].valueCount);
         }
-        std::copy_n(vampFeatureV1.values, vampFeatureV1.valueCount, feature.begin());
+        return featureSet_;
     }
 
-    descriptor_.releaseFeatureSet(vampFeatureLists);
+    auto* vampFeatureLists = callProcess(getInputBuffers(buffer), nsec);
+    const helper::ScopeExit release([&] { descriptor_.releaseFeatureSet(vampFeatureLists); });
 
+    for (size_t i = 0; i < outputCount_; ++i) {
+        // NOLINTNEXTLINE(*pointer-arithmetic)
+        const auto& vampFeatureV1 = getSingleFeature(vampFeatureLists[i], i);
+        assignFeature(featureSet_[i], vampFeatureV1.values, vampFeatureV1.valueCount);
+    }
     return featureSet_;
 }
 
-void PluginHostAdapter::checkRequirements() {
-    using Error = std::runtime_error;
+Plugin::FeatureViewSet PluginHostAdapter::processView(InputBuffer buffer, uint64_t nsec) {
+    checkInitialised();
+    checkOneSamplePerStep();
+    checkInputBuffer(buffer);
+    checkInputBlockSize(buffer);
+    releasePendingFeatureSet();
+    lastTimestamp_ = nsec;
 
-    if (descriptor_.vampApiVersion < 1 || descriptor_.vampApiVersion > 2) {
-        throw Error("Only Vamp API versions 1 and 2 supported");
+    if (extension_ != nullptr) {
+        const auto* features = callProcessExtension(getInputBuffers(buffer), nsec);
+        for (size_t i = 0; i < outputCount_; ++i) {
+            // NOLINTNEXTLINE(*pointer-arithmetic)
+            featureViews_[i] = FeatureView(features[i].values, features[i].valueCount);
+        }
+        return featureViews_;
     }
 
-    if (descriptor_.getMinChannelCount(handle_) > 1) {
-        throw Error("Minimum channel count > 1 not supported");
+    // feature set is released with the next call, see Plugin::processView
+    pendingFeatureLists_ = callProcess(getInputBuffers(buffer), nsec);
+
+    for (size_t i = 0; i < outputCount_; ++i) {
+        // NOLINTNEXTLINE(*pointer-arithmetic)
+        const auto& vampFeatureV1 = getSingleFeature(pendingFeatureLists_[i], i);
+        featureViews_[i] = FeatureView(vampFeatureV1.values, vampFeatureV1.valueCount);
     }
 
-    for (uint32_t outputIndex = 0; outputIndex < getOutputCount(); ++outputIndex) {
-        auto* outputDescriptor = descriptor_.getOutputDescriptor(handle_, outputIndex);
-        const helper::ScopeExit deleter([&] {
-            descriptor_.releaseOutputDescriptor(outputDescriptor);
-        });
+    return featureViews_;
+}
+
+void PluginHostAdapter::processBatch(const InputBlocks& blocks, FeatureMatrix features) {
+    checkInitialised();
+    checkOneSamplePerStep();
+    checkInputBuffer(blocks.buffer);
+    releasePendingFeatureSet();
+
+    const size_t blockCount = blocks.timestamps.size();
+    if (blockCount == 0) {
+        return;
+    }
+    lastTimestamp_ = blocks.timestamps.back();
 
-        if (outputDescriptor == nullptr) {
-            throw Error(helper::concat("Output descriptor ", outputIndex, " is null"));
+    const size_t blockSize = getInputDomain() == InputDomain::Time
+        ? initialisedBlockSize_
+        : initialisedBlockSize_ / 2 + 1;
+    const size_t requiredInputSize = (blockCount - 1) * blocks.hopSize + blockSize;
+    if (getInputSizeRange(blocks.buffer).first < requiredInputSize) {
+        throw std::invalid_argument(
+            helper::concat(
+                "Input buffer too small: ", blockCount, " blocks with hop size ", blocks.hopSize,
+                " require ", requiredInputSize, " elements"
+            )
+        );
+    }
+
+    const size_t rowSize = std::accumulate(
+        outputs_.begin(), outputs_.end(), size_t{0}, [](size_t sum, auto&& output) {
+            return sum + output.binCount;
         }
+    );
+    if (features.size() < blockCount * rowSize) {
+        throw std::invalid_argument(
+            helper::concat(
+                "Feature matrix too small: ", blockCount, " blocks require ", blockCount * rowSize,
+                " elements"
+            )
+        );
+    }
+
+    float* outputData = features.data();
 
-        if (outputDescriptor->hasFixedBinCount != 1) {
-            throw Error(
+    const auto copyFeature = [&](size_t outputIndex, const float* values, size_t valueCount) {
+        const auto binCount = outputs_[outputIndex].binCount;
+        if (valueCount != binCount) {
+            throw std::runtime_error(
                 helper::concat(
-                    "Dynamic bin count of output \"",
-                    outputDescriptor->identifier,
-                    "\" not supported"
+                    "Feature value count of output ", outputIndex, " does not match bin count: ",
+                    valueCount, " != ", binCount
                 )
             );
         }
-        if (outputDescriptor->sampleType != vampOneSamplePerStep) {
-            throw Error(
-                helper::concat(
-                    "Sample type of output \"",
-                    outputDescriptor->identifier,
-                    "\" not supported (OneSamplePerStep required)"
-                )
-            );
+        outputData = std::copy_n(values, valueCount, outputData);
+    };
+
+    for (size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex) {
+        // NOLINTBEGIN(*pointer-arithmetic)
+        const auto*    inputBuffers = getInputBuffers(blocks.buffer, blockIndex * blocks.hopSize);
+        const uint64_t nsec         = blocks.timestamps[blockIndex];
+
+        if (extension_ != nullptr) {
+            const auto* rtvampFeatures = callProcessExtension(inputBuffers, nsec);
+            for (size_t i = 0; i < outputCount_; ++i) {
+                copyFeature(i, rtvampFeatures[i].values, rtvampFeatures[i].valueCount);
+            }
+            continue;
+        }
+
+        auto* vampFeatureLists = callProcess(inputBuffers, nsec);
+
+        const helper::ScopeExit release([&] { descriptor_.releaseFeatureSet(vampFeatureLists); });
+
+        for (size_t i = 0; i < outputCount_; ++i) {
+            const auto& vampFeatureV1 = getSingleFeature(vampFeatureLists[i], i);
+            copyFeature(i, vampFeatureV1.values, vampFeatureV1.valueCount);
+        }
+        // NOLINTEND(*pointer-arithmetic)
+    }
+}
+
+static uint64_t toNanoseconds(int sec, int nsec) noexcept {
+    const auto value = static_cast<int64_t>(sec) * 1'000'000'000 + nsec;
+    return value > 0 ? static_cast<uint64_t>(value) : 0;  // negative timestamps not representable
+}
+
+static uint64_t getSamplePeriod(float sampleRate) noexcept {
+    return sampleRate > 0.0f ? static_cast<uint64_t>(std::llround(1e9 / sampleRate)) : 0;
+}
+
+Plugin::FeatureEventSet PluginHostAdapter::collectFeatureEvents(
+    const VampFeatureList* vampFeatureLists, uint64_t nsec
+) {
+    const bool hasFeatureV2 = descriptor_.vampApiVersion >= 2;
+
+    for (size_t i = 0; i < outputCount_; ++i) {
+        // NOLINTBEGIN(*pointer-arithmetic)
+        const auto& vampFeatureList = vampFeatureLists[i];
+        const auto& output          = outputs_[i];
+        auto&       arena           = eventArenas_[i];
+        const auto  featureCount    = vampFeatureList.featureCount;
+
+        // reserve storage upfront, the views of the events must not be invalidated by reallocations
+        size_t valueCount = 0;
+        size_t labelSize  = 0;
+        for (size_t j = 0; j < featureCount; ++j) {
+            const auto& feature = vampFeatureList.features[j].v1;
+            valueCount += feature.valueCount;
+            labelSize  += feature.label != nullptr ? std::strlen(feature.label) : 0;
+        }
+        arena.clear();
+        arena.events.reserve(featureCount);
+        arena.values.reserve(valueCount);
+        arena.labels.reserve(labelSize);
+
+        for (size_t j = 0; j < featureCount; ++j) {
+            const auto& feature = vampFeatureList.features[j].v1;
+
+            FeatureEvent event;
+            event.timestamp = nsec;
+            if (output.sampleType != SampleType::OneSamplePerStep && feature.hasTimestamp != 0) {
+                event.timestamp = toNanoseconds(feature.sec, feature.nsec);
+            } else if (output.sampleType == SampleType::FixedSampleRate && arena.nextTimestamp) {
+                event.timestamp = arena.nextTimestamp.value();
+            }
+            if (output.sampleType == SampleType::FixedSampleRate) {
+                arena.nextTimestamp = event.timestamp + getSamplePeriod(output.sampleRate);
+            }
+
+            if (hasFeatureV2) {
+                const auto& featureV2 = vampFeatureList.features[featureCount + j].v2;
+                if (featureV2.hasDuration != 0) {
+                    event.duration = toNanoseconds(featureV2.durationSec, featureV2.durationNsec);
+                }
+            }
+
+            const auto valuesOffset = arena.values.size();
+            arena.values.insert(arena.values.end(), feature.values, feature.values + feature.valueCount);
+            event.values = std::span(arena.values).subspan(valuesOffset);
+
+            if (feature.label != nullptr) {
+                const auto labelOffset = arena.labels.size();
+                arena.labels.append(feature.label);
+                event.label = std::string_view(arena.labels).substr(labelOffset);
+            }
+
+            arena.events.push_back(event);
+        }
+        // NOLINTEND(*pointer-arithmetic)
+
+        eventLists_[i] = arena.events;
+    }
+    return eventLists_;
+}
+
+Plugin::FeatureEventSet PluginHostAdapter::processEvents(InputBuffer buffer, uint64_t nsec) {
+    checkInitialised();
+    checkInputBuffer(buffer);
+    checkInputBlockSize(buffer);
+    releasePendingFeatureSet();
+    lastTimestamp_ = nsec;
+
+    if (extension_ != nullptr) {
+        const auto* features = callProcessExtension(getInputBuffers(buffer), nsec);
+        for (size_t i = 0; i < outputCount_; ++i) {
+            auto& arena = eventArenas_[i];
+            arena.clear();
+            // NOLINTNEXTLINE(*pointer-arithmetic)
+            arena.values.assign(features[i].values, features[i].values + features[i].valueCount);
+            FeatureEvent event;
+            event.timestamp = nsec;
+            event.values    = arena.values;
+            arena.events.push_back(event);
+            eventLists_[i] = arena.events;
         }
+        return eventLists_;
     }
+
+    auto* vampFeatureLists = callProcess(getInputBuffers(buffer), nsec);
+    const helper::ScopeExit release([&] { descriptor_.releaseFeatureSet(vampFeatureLists); });
+    return collectFeatureEvents(vampFeatureLists, nsec);
+}
+
+Plugin::FeatureEventSet PluginHostAdapter::getRemainingFeatures() {
+    checkInitialised();
+    releasePendingFeatureSet();
+
+    auto* vampFeatureLists = descriptor_.getRemainingFeatures(handle_);
+    if (vampFeatureLists == nullptr) {
+        throw std::runtime_error("Returned feature list is null");
+    }
+    const helper::ScopeExit release([&] { descriptor_.releaseFeatureSet(vampFeatureLists); });
+    return collectFeatureEvents(vampFeatureLists, lastTimestamp_);
+}
+
+void PluginHostAdapter::checkRequirements() {
+    using Error = std::runtime_error;
+
+    if (descriptor_.vampApiVersion < 1 || descriptor_.vampApiVersion > 2) {
+        throw Error("Only Vamp API versions 1 and 2 supported");
+    }
+
+    // query output descriptors once, throws if an output descriptor is null
+    updateOutputDescriptors();
 }
 
 }  // namespace rtvamp::hostsdk
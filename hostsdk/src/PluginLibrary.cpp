@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <stdexcept>
+#include <utility>  // move
 
 #include "vamp/vamp.h"
 
@@ -12,16 +13,26 @@
 
 namespace rtvamp::hostsdk {
 
-PluginLibrary::PluginLibrary(const std::filesystem::path& libraryPath) {
+static std::shared_ptr<DynamicLibrary> loadDynamicLibrary(const std::filesystem::path& libraryPath) {
     if (!std::filesystem::exists(libraryPath)) {
         throw std::runtime_error(helper::concat("Dynamic library does not exist: ", libraryPath));
     }
 
-    dl_ = std::make_shared<DynamicLibrary>();
+    auto dl = std::make_shared<DynamicLibrary>();
 
-    if (!dl_->load(libraryPath)) {
+    if (!dl->load(libraryPath)) {
         throw std::runtime_error(helper::concat("Error loading dynamic library: ", libraryPath));
     }
+    return dl;
+}
+
+PluginLibrary::PluginLibrary(const std::filesystem::path& libraryPath)
+    : PluginLibrary(loadDynamicLibrary(libraryPath)) {}
+
+PluginLibrary::PluginLibrary(std::shared_ptr<DynamicLibrary> library) : dl_(std::move(library)) {
+    if (dl_ == nullptr || !dl_->isLoaded()) {
+        throw std::invalid_argument("Dynamic library not loaded");
+    }
 
     constexpr const char* symbol = "vampGetPluginDescriptor";
     const auto func = dl_->getFunction<VampGetPluginDescriptorFunction>(symbol);
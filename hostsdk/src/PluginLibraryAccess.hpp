@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <utility>  // move
+
+#include "rtvamp/hostsdk/PluginLibrary.hpp"
+
+#include "DynamicLibrary.hpp"
+
+namespace rtvamp::hostsdk {
+
+/**
+ * Internal access to the private PluginLibrary constructor from an already loaded library
+ * (used by the discovery functions to avoid loading a library twice).
+ */
+class PluginLibraryAccess {
+public:
+    static PluginLibrary create(std::shared_ptr<DynamicLibrary> library) {
+        return PluginLibrary(std::move(library));
+    }
+};
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,100 @@
+#include "rtvamp/hostsdk/PluginRegistry.hpp"
+
+#include <algorithm>  // sort
+#include <set>
+#include <stdexcept>
+#include <utility>  // move
+
+#include "rtvamp/hostsdk.hpp"
+
+#include "DynamicLibrary.hpp"
+#include "LibraryProbe.hpp"
+#include "PluginLibraryAccess.hpp"
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+template <typename Map>
+static auto find(const Map& map, std::string_view key) {
+#ifdef __cpp_lib_generic_unordered_lookup
+    return map.find(key);
+#else
+    return map.find(std::string(key));
+#endif
+}
+
+PluginRegistry::PluginRegistry() : PluginRegistry(getVampPaths()) {}
+
+PluginRegistry::PluginRegistry(std::span<const std::filesystem::path> paths) {
+    std::set<std::filesystem::path> visited;  // paths may have duplicates
+
+    const auto addLibrary = [&](const std::filesystem::path& libraryPath) {
+        if (!visited.insert(libraryPath).second) {
+            return;
+        }
+        const auto libraryName = libraryPath.stem().string();
+        if (libraryIndices_.contains(libraryName)) {
+            return;  // first library in search paths takes precedence
+        }
+        auto dl = openVampLibrary(libraryPath);
+        if (dl == nullptr) {
+            return;
+        }
+        try {
+            auto          library = PluginLibraryAccess::create(std::move(dl));
+            const auto    keys = library.listPlugins();
+            const auto    libraryIndex = libraries_.size();
+            libraries_.push_back(std::move(library));
+            libraryIndices_.emplace(libraryName, libraryIndex);
+            for (size_t pluginIndex = 0; pluginIndex < keys.size(); ++pluginIndex) {
+                plugins_.try_emplace(std::string(keys[pluginIndex].get()), PluginEntry{libraryIndex, pluginIndex});
+            }
+        } catch (const std::exception&) {}  // NOLINT(*empty-catch)
+    };
+
+    for (auto&& path : paths) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(path, ec)) {
+            for (auto&& entry : std::filesystem::recursive_directory_iterator(path, ec)) {
+                if (helper::isLibraryCandidate(entry)) {
+                    addLibrary(entry.path());
+                }
+            }
+        } else if (std::filesystem::is_regular_file(path, ec)) {
+            addLibrary(path);
+        }
+    }
+}
+
+std::vector<PluginKey> PluginRegistry::listPlugins() const {
+    std::vector<PluginKey> result;
+    result.reserve(plugins_.size());
+    for (auto&& [key, entry] : plugins_) {
+        result.emplace_back(key);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+bool PluginRegistry::contains(const PluginKey& key) const {
+    return find(plugins_, key.get()) != plugins_.end();
+}
+
+const PluginLibrary* PluginRegistry::findLibrary(std::string_view libraryName) const {
+    const auto it = find(libraryIndices_, libraryName);
+    if (it == libraryIndices_.end()) {
+        return nullptr;
+    }
+    return &libraries_[it->second];
+}
+
+std::unique_ptr<Plugin> PluginRegistry::loadPlugin(const PluginKey& key, float inputSampleRate) const {
+    const auto it = find(plugins_, key.get());
+    if (it == plugins_.end()) {
+        throw std::invalid_argument(helper::concat("Plugin not found: ", key.get()));
+    }
+    const auto& [libraryIndex, pluginIndex] = it->second;
+    return libraries_[libraryIndex].loadPlugin(pluginIndex, inputSampleRate);
+}
+
+}  // namespace rtvamp::hostsdk
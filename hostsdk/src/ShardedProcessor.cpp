@@ -0,0 +1,217 @@
+#include "rtvamp/hostsdk/ShardedProcessor.hpp"
+
+#include <algorithm>  // clamp, max, min
+#include <exception>
+#include <mutex>
+#include <numeric>  // accumulate
+#include <stdexcept>
+#include <thread>
+#include <variant>
+
+#include "rtvamp/hostsdk/PluginLibrary.hpp"
+
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+ShardedProcessor::ShardedProcessor(
+    const PluginLibrary& library,
+    const PluginKey&     key,
+    float                inputSampleRate,
+    const Options&       options
+)
+    : stepSize_(options.stepSize),
+      blockSize_(options.blockSize),
+      channelCount_(options.channelCount) {
+    if (stepSize_ == 0 || blockSize_ == 0) {
+        throw std::invalid_argument("Step size and block size must be greater than zero");
+    }
+    if (channelCount_ == 0) {
+        throw std::invalid_argument("Channel count must be greater than zero");
+    }
+
+    const auto addInstance = [&] {
+        auto& instance  = instances_.emplace_back();
+        instance.plugin = library.loadPlugin(key, inputSampleRate);
+        if (!instance.plugin->initialise(stepSize_, blockSize_, channelCount_)) {
+            throw std::runtime_error(
+                helper::concat("Initialisation of plugin \"", instance.plugin->getIdentifier(), "\" failed")
+            );
+        }
+        if (instance.plugin->getInputDomain() == Plugin::InputDomain::Frequency) {
+            instance.spectralFrontEnd.emplace(blockSize_, channelCount_, options.windowType);
+        }
+    };
+
+    addInstance();
+    const auto& plugin = *instances_.front().plugin;
+    if (plugin.isStateless()) {
+        shardable_ = true;
+    } else {
+        const uint32_t warmUpLength = options.warmUpLength.value_or(plugin.getWarmUpLength());
+        shardable_    = warmUpLength > 0;
+        warmUpBlocks_ = (warmUpLength + stepSize_ - 1) / stepSize_;  // complete blocks covering the warm-up
+    }
+
+    if (shardable_) {
+        const unsigned int threads = options.threads == 0
+            ? std::max(std::thread::hardware_concurrency(), 1U)
+            : options.threads;
+        instances_.reserve(threads);
+        while (instances_.size() < threads) {
+            addInstance();
+        }
+    }
+}
+
+bool ShardedProcessor::setParameter(std::string_view id, float value) {
+    bool result = true;
+    for (auto& instance : instances_) {
+        result &= instance.plugin->setParameter(id, value);
+    }
+    return result;
+}
+
+bool ShardedProcessor::selectProgram(std::string_view name) {
+    bool result = true;
+    for (auto& instance : instances_) {
+        result &= instance.plugin->selectProgram(name);
+    }
+    return result;
+}
+
+static std::vector<Plugin::TimeDomainBuffer> getChannels(const Plugin::InputBuffer& signal, uint32_t channelCount) {
+    if (const auto* buffer = std::get_if<Plugin::TimeDomainBuffer>(&signal)) {
+        if (channelCount != 1) {
+            throw std::invalid_argument(
+                helper::concat("Single channel input buffer, but channel count is ", channelCount)
+            );
+        }
+        return {*buffer};
+    }
+    if (const auto* channels = std::get_if<Plugin::TimeDomainChannels>(&signal)) {
+        if (channels->size() != channelCount) {
+            throw std::invalid_argument(
+                helper::concat("Channel count of input buffer must be ", channelCount)
+            );
+        }
+        for (const auto& channel : *channels) {
+            if (channel.size() != channels->front().size()) {
+                throw std::invalid_argument("All channels must have the same size");
+            }
+        }
+        return {channels->begin(), channels->end()};
+    }
+    throw std::invalid_argument("Signal must be in time domain");
+}
+
+void ShardedProcessor::processBlocks(
+    Instance&                                 instance,
+    std::span<const Plugin::TimeDomainBuffer> channels,
+    std::span<const uint64_t>                 timestamps,
+    size_t                                    firstBlock,
+    size_t                                    blockCount,
+    Plugin::FeatureMatrix                     features
+) const {
+    if (blockCount == 0) {
+        return;
+    }
+
+    std::vector<Plugin::TimeDomainBuffer> blockChannels(channels.size());
+    const auto getInput = [&](size_t offset, size_t size) -> Plugin::InputBuffer {
+        for (size_t c = 0; c < channels.size(); ++c) {
+            blockChannels[c] = channels[c].subspan(offset, size);
+        }
+        if (blockChannels.size() == 1) {
+            return blockChannels.front();
+        }
+        return Plugin::TimeDomainChannels(blockChannels);
+    };
+
+    auto& plugin = *instance.plugin;
+    if (!instance.spectralFrontEnd) {
+        // all blocks with a single batch call, read directly from the signal
+        const size_t offset = firstBlock * stepSize_;
+        plugin.processBatch(
+            {
+                .buffer     = getInput(offset, channels.front().size() - offset),
+                .hopSize    = stepSize_,
+                .timestamps = timestamps.subspan(firstBlock, blockCount),
+            },
+            features
+        );
+        return;
+    }
+
+    const size_t rowSize = features.size() / blockCount;
+    for (size_t i = 0; i < blockCount; ++i) {
+        const size_t block    = firstBlock + i;
+        const auto   spectrum = instance.spectralFrontEnd->compute(getInput(block * stepSize_, blockSize_));
+        plugin.processBatch(
+            {
+                .buffer     = spectrum,
+                .hopSize    = instance.spectralFrontEnd->getBinCount(),
+                .timestamps = timestamps.subspan(block, 1),
+            },
+            features.subspan(i * rowSize, rowSize)
+        );
+    }
+}
+
+ShardedProcessor::Result ShardedProcessor::process(const Plugin::InputBuffer& signal) {
+    const auto   channels   = getChannels(signal, channelCount_);
+    const size_t frameCount = channels.front().size();
+    const size_t blockCount = frameCount >= blockSize_ ? (frameCount - blockSize_) / stepSize_ + 1 : 0;
+    const auto&  plugin     = *instances_.front().plugin;
+
+    Result result;
+    const auto outputs = plugin.getOutputDescriptors();
+    result.rowSize = std::accumulate(
+        outputs.begin(), outputs.end(), size_t{0}, [](size_t sum, auto&& output) {
+            return sum + output.binCount;
+        }
+    );
+    result.timestamps.resize(blockCount);
+    for (size_t i = 0; i < blockCount; ++i) {
+        result.timestamps[i] = helper::getTimestamp(i * stepSize_, plugin.getInputSampleRate());
+    }
+    result.features.resize(blockCount * result.rowSize);
+
+    // shards should be longer than the warm-up, otherwise the warm-up blocks dominate
+    const size_t shardCount = std::clamp<size_t>(
+        blockCount / std::max<size_t>(warmUpBlocks_, 1), 1, instances_.size()
+    );
+
+    std::mutex         exceptionMutex;
+    std::exception_ptr exception;
+    helper::parallelFor(shardCount, static_cast<unsigned int>(shardCount), [&](size_t shard) {
+        try {
+            auto&        instance = instances_[shard];
+            const size_t first    = blockCount * shard / shardCount;
+            const size_t last     = blockCount * (shard + 1) / shardCount;
+            const size_t warmUp   = std::min<size_t>(warmUpBlocks_, first);
+            instance.plugin->reset();
+            instance.warmUpFeatures.resize(warmUp * result.rowSize);
+            processBlocks(instance, channels, result.timestamps, first - warmUp, warmUp, instance.warmUpFeatures);
+            processBlocks(
+                instance,
+                channels,
+                result.timestamps,
+                first,
+                last - first,
+                Plugin::FeatureMatrix(result.features).subspan(first * result.rowSize, (last - first) * result.rowSize)
+            );
+        } catch (...) {
+            const std::lock_guard lock(exceptionMutex);
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+    });
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    return result;
+}
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,69 @@
+#include "rtvamp/hostsdk/SpectralFrontEnd.hpp"
+
+#include <stdexcept>
+#include <variant>
+
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+SpectralFrontEnd::SpectralFrontEnd(
+    uint32_t blockSize, uint32_t channelCount, WindowType windowType, const FFTBackend& backend
+)
+    : blockSize_(blockSize),
+      channelCount_(channelCount),
+      windowType_(windowType),
+      window_(hostsdk::getWindow(windowType, blockSize)),
+      fft_(blockSize, backend) {  // throws if block size is zero
+    if (channelCount == 0) {
+        throw std::invalid_argument("Channel count must be greater than zero");
+    }
+    windowed_.resize(blockSize);
+    spectrum_.resize(static_cast<size_t>(channelCount) * getBinCount());
+    spectrumChannels_.resize(channelCount);
+    for (uint32_t channel = 0; channel < channelCount; ++channel) {
+        spectrumChannels_[channel] = Plugin::FrequencyDomainBuffer(spectrum_).subspan(
+            static_cast<size_t>(channel) * getBinCount(), getBinCount()
+        );
+    }
+}
+
+void SpectralFrontEnd::computeChannel(Plugin::TimeDomainBuffer input, uint32_t channel) {
+    if (input.size() != blockSize_) {
+        throw std::invalid_argument(
+            helper::concat("Wrong input buffer size: ", input.size(), " (expected: ", blockSize_, ")")
+        );
+    }
+    applyWindow(input, *window_, windowed_);
+    const auto binCount = getBinCount();
+    fft_.compute(
+        windowed_,
+        std::span(spectrum_).subspan(static_cast<size_t>(channel) * binCount, binCount)
+    );
+}
+
+Plugin::InputBuffer SpectralFrontEnd::compute(const Plugin::InputBuffer& timeDomain) {
+    if (const auto* buffer = std::get_if<Plugin::TimeDomainBuffer>(&timeDomain)) {
+        if (channelCount_ != 1) {
+            throw std::invalid_argument(
+                helper::concat("Invalid channel count: 1 (expected: ", channelCount_, ")")
+            );
+        }
+        computeChannel(*buffer, 0);
+        return spectrumChannels_[0];
+    }
+    if (const auto* channels = std::get_if<Plugin::TimeDomainChannels>(&timeDomain)) {
+        if (channels->size() != channelCount_) {
+            throw std::invalid_argument(
+                helper::concat("Invalid channel count: ", channels->size(), " (expected: ", channelCount_, ")")
+            );
+        }
+        for (uint32_t channel = 0; channel < channelCount_; ++channel) {
+            computeChannel((*channels)[channel], channel);
+        }
+        return Plugin::FrequencyDomainChannels(spectrumChannels_);
+    }
+    throw std::invalid_argument("Input buffer must be in time domain");
+}
+
+}  // namespace rtvamp::hostsdk
@@ -0,0 +1,205 @@
+#include "rtvamp/hostsdk/StreamProcessor.hpp"
+
+#include <algorithm>  // any_of, copy_n, min, max
+#include <stdexcept>
+#include <utility>  // move
+
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+StreamProcessor::StreamProcessor(
+    std::span<Plugin* const> plugins,
+    uint32_t                 stepSize,
+    uint32_t                 blockSize,
+    uint32_t                 channelCount,
+    Callback                 callback,
+    size_t                   capacity,
+    WindowType               windowType
+)
+    : plugins_(plugins.begin(), plugins.end()),
+      stepSize_(stepSize),
+      blockSize_(blockSize),
+      channelCount_(channelCount),
+      callback_(std::move(callback)),
+      capacity_(std::max<size_t>(capacity, 2 * static_cast<size_t>(blockSize))),
+      sampleRate_(plugins.empty() ? 0.0F : plugins.front()->getInputSampleRate()) {
+    if (stepSize == 0 || blockSize == 0) {
+        throw std::invalid_argument("Step size and block size must be greater than zero");
+    }
+    if (channelCount == 0) {
+        throw std::invalid_argument("Channel count must be greater than zero");
+    }
+    if (plugins.empty()) {
+        throw std::invalid_argument("At least one plugin required");
+    }
+    for (auto* plugin : plugins_) {
+        if (plugin == nullptr) {
+            throw std::invalid_argument("Plugin is null");
+        }
+        if (plugin->getInputSampleRate() != sampleRate_) {
+            throw std::invalid_argument(
+                helper::concat("Input sample rate of plugin \"", plugin->getIdentifier(), "\" does not match")
+            );
+        }
+    }
+    for (auto* plugin : plugins_) {
+        if (!plugin->initialise(stepSize, blockSize, channelCount)) {
+            throw std::runtime_error(
+                helper::concat("Initialisation of plugin \"", plugin->getIdentifier(), "\" failed")
+            );
+        }
+    }
+    buffer_.resize(channelCount_ * (capacity_ + blockSize_));
+    blockChannels_.resize(channelCount_);
+
+    const bool requiresSpectrum = std::any_of(plugins_.begin(), plugins_.end(), [](const Plugin* plugin) {
+        return plugin->getInputDomain() == Plugin::InputDomain::Frequency;
+    });
+    if (requiresSpectrum) {
+        spectralFrontEnd_.emplace(blockSize_, channelCount_, windowType);
+    }
+}
+
+size_t StreamProcessor::getWritableSamples() const noexcept {
+    const uint64_t writePosition = writePosition_.load(std::memory_order_relaxed);
+    const uint64_t readPosition  = readPosition_.load(std::memory_order_acquire);
+    const uint64_t used          = writePosition > readPosition ? writePosition - readPosition : 0;
+    return capacity_ - static_cast<size_t>(used);
+}
+
+template <typename CopyChannel>
+size_t StreamProcessor::write(size_t sampleCount, CopyChannel&& copyChannel) {
+    const uint64_t writePosition = writePosition_.load(std::memory_order_relaxed);
+    const size_t   count         = std::min(sampleCount, getWritableSamples());
+    const size_t   stride        = capacity_ + blockSize_;
+
+    for (uint32_t channel = 0; channel < channelCount_; ++channel) {
+        float* data = buffer_.data() + channel * stride;  // NOLINT(*pointer-arithmetic)
+        size_t done = 0;
+        while (done < count) {
+            const size_t index = static_cast<size_t>((writePosition + done) % capacity_);
+            const size_t n     = std::min(count - done, capacity_ - index);
+            // NOLINTBEGIN(*pointer-arithmetic)
+            copyChannel(channel, done, n, data + index);
+            if (index < blockSize_) {
+                // mirror the beginning behind the end, blocks across the end stay contiguous
+                std::copy_n(data + index, std::min<size_t>(n, blockSize_ - index), data + capacity_ + index);
+            }
+            // NOLINTEND(*pointer-arithmetic)
+            done += n;
+        }
+    }
+
+    writePosition_.store(writePosition + count, std::memory_order_release);
+    return count;
+}
+
+size_t StreamProcessor::writeInterleaved(std::span<const float> samples) {
+    if (samples.size() % channelCount_ != 0) {
+        throw std::invalid_argument(
+            helper::concat("Number of samples must be a multiple of the channel count (", channelCount_, ")")
+        );
+    }
+    return write(
+        samples.size() / channelCount_,
+        [&](uint32_t channel, size_t offset, size_t count, float* output) {
+            const float* input = samples.data() + offset * channelCount_ + channel;  // NOLINT(*pointer-arithmetic)
+            for (size_t i = 0; i < count; ++i) {
+                output[i] = input[i * channelCount_];  // NOLINT(*pointer-arithmetic)
+            }
+        }
+    );
+}
+
+size_t StreamProcessor::writePlanar(std::span<const std::span<const float>> channels) {
+    if (channels.size() != channelCount_) {
+        throw std::invalid_argument(
+            helper::concat("Invalid channel count: ", channels.size(), " (expected: ", channelCount_, ")")
+        );
+    }
+    const size_t sampleCount = channels[0].size();
+    for (const auto& channel : channels) {
+        if (channel.size() != sampleCount) {
+            throw std::invalid_argument("All channels must have the same number of samples");
+        }
+    }
+    return write(
+        sampleCount,
+        [&](uint32_t channel, size_t offset, size_t count, float* output) {
+            std::copy_n(channels[channel].data() + offset, count, output);  // NOLINT(*pointer-arithmetic)
+        }
+    );
+}
+
+size_t StreamProcessor::process() {
+    const size_t stride       = capacity_ + blockSize_;
+    uint64_t     readPosition = readPosition_.load(std::memory_order_relaxed);
+    size_t       blockCount   = 0;
+
+    while (writePosition_.load(std::memory_order_acquire) >= readPosition + blockSize_) {
+        const size_t index = static_cast<size_t>(readPosition % capacity_);
+        for (uint32_t channel = 0; channel < channelCount_; ++channel) {
+            // NOLINTNEXTLINE(*pointer-arithmetic)
+            blockChannels_[channel] = Plugin::TimeDomainBuffer(buffer_.data() + channel * stride + index, blockSize_);
+        }
+        const auto input = channelCount_ == 1
+            ? Plugin::InputBuffer(blockChannels_[0])
+            : Plugin::InputBuffer(Plugin::TimeDomainChannels(blockChannels_));
+        const auto spectrum = spectralFrontEnd_
+            ? spectralFrontEnd_->compute(input)
+            : Plugin::InputBuffer{};
+        const uint64_t nsec = getTimestamp(readPosition);
+
+        for (size_t i = 0; i < plugins_.size(); ++i) {
+            const bool isTimeDomain = plugins_[i]->getInputDomain() == Plugin::InputDomain::Time;
+            const auto features     = plugins_[i]->process(isTimeDomain ? input : spectrum, nsec);
+            if (callback_) {
+                callback_(i, nsec, features);
+            }
+        }
+
+        readPosition += stepSize_;
+        readPosition_.store(readPosition, std::memory_order_release);
+        ++blockCount;
+    }
+    return blockCount;
+}
+
+void StreamProcessor::pushInterleaved(std::span<const float> samples) {
+    size_t offset = 0;
+    do {
+        offset += writeInterleaved(samples.subspan(offset)) * channelCount_;
+        process();
+    } while (offset < samples.size());
+}
+
+void StreamProcessor::pushPlanar(std::span<const std::span<const float>> channels) {
+    const size_t sampleCount = channels.empty() ? 0 : channels[0].size();
+    size_t       offset      = writePlanar(channels);  // validates the channels
+    process();
+    while (offset < sampleCount) {
+        offset += write(
+            sampleCount - offset,
+            [&](uint32_t channel, size_t channelOffset, size_t count, float* output) {
+                // NOLINTNEXTLINE(*pointer-arithmetic)
+                std::copy_n(channels[channel].data() + offset + channelOffset, count, output);
+            }
+        );
+        process();
+    }
+}
+
+void StreamProcessor::reset() {
+    writePosition_.store(0, std::memory_order_relaxed);
+    readPosition_.store(0, std::memory_order_relaxed);
+    for (auto* plugin : plugins_) {
+        plugin->reset();
+    }
+}
+
+uint64_t StreamProcessor::getTimestamp(uint64_t samplePosition) const noexcept {
+    return helper::getTimestamp(samplePosition, sampleRate_);
+}
+
+}  // namespace rtvamp::hostsdk
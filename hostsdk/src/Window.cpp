@@ -0,0 +1,251 @@
+#include "rtvamp/hostsdk/Window.hpp"
+
+#include <algorithm>  // min
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <numbers>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+#include "helper.hpp"
+
+namespace rtvamp::hostsdk {
+
+// reference: https://en.wikipedia.org/wiki/Window_function
+static AlignedVector<float> cosineSum(uint32_t length, double a0, double a1, double a2, double a3) {
+    AlignedVector<float> window(length, 1.0F);
+    if (length < 2) {
+        return window;
+    }
+    for (uint32_t i = 0; i < length; ++i) {
+        const double factor = std::numbers::pi * static_cast<double>(i) / static_cast<double>(length - 1);
+        window[i] = static_cast<float>(
+            a0
+            - a1 * std::cos(2.0 * factor)
+            + a2 * std::cos(4.0 * factor)
+            - a3 * std::cos(6.0 * factor)
+        );
+    }
+    return window;
+}
+
+// modified Bessel function of the first kind (order 0), power series
+static double besselI0(double x) {
+    double sum  = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 50; ++k) {
+        const double factor = x / (2.0 * k);
+        term *= factor * factor;
+        sum += term;
+        if (term < sum * 1e-16) {
+            break;
+        }
+    }
+    return sum;
+}
+
+static AlignedVector<float> kaiser(uint32_t length, double beta) {
+    AlignedVector<float> window(length, 1.0F);
+    if (length < 2) {
+        return window;
+    }
+    const double denominator = besselI0(beta);
+    for (uint32_t i = 0; i < length; ++i) {
+        const double ratio = 2.0 * static_cast<double>(i) / static_cast<double>(length - 1) - 1.0;
+        window[i] = static_cast<float>(besselI0(beta * std::sqrt(1.0 - ratio * ratio)) / denominator);
+    }
+    return window;
+}
+
+static AlignedVector<float> createWindow(WindowType type, uint32_t length, float kaiserBeta) {
+    switch (type) {
+    case WindowType::Rectangular:
+        return AlignedVector<float>(length, 1.0F);
+    case WindowType::Hann:
+        return cosineSum(length, 0.5, 0.5, 0.0, 0.0);
+    case WindowType::Hamming:
+        return cosineSum(length, 0.54, 0.46, 0.0, 0.0);
+    case WindowType::Blackman:
+        return cosineSum(length, 0.42, 0.5, 0.08, 0.0);
+    case WindowType::BlackmanHarris:
+        return cosineSum(length, 0.35875, 0.48829, 0.14128, 0.01168);
+    case WindowType::Kaiser:
+        return kaiser(length, kaiserBeta);
+    }
+    throw std::invalid_argument("Invalid window type");
+}
+
+std::shared_ptr<const AlignedVector<float>> getWindow(WindowType type, uint32_t length, float kaiserBeta) {
+    static std::mutex mutex;
+    // weak references, windows are released if not used anymore
+    static std::map<std::tuple<WindowType, uint32_t, float>, std::weak_ptr<const AlignedVector<float>>> cache;
+
+    if (type != WindowType::Kaiser) {
+        kaiserBeta = 0.0F;  // share windows independent of the unused parameter
+    }
+
+    const std::lock_guard lock(mutex);
+    auto& entry = cache[{type, length, kaiserBeta}];
+    auto window = entry.lock();
+    if (!window) {
+        window = std::make_shared<const AlignedVector<float>>(createWindow(type, length, kaiserBeta));
+        entry  = window;
+    }
+    return window;
+}
+
+void applyWindow(std::span<const float> input, std::span<const float> window, std::span<float> output) {
+    if (input.size() != window.size() || output.size() != window.size()) {
+        throw std::invalid_argument(
+            helper::concat(
+                "Window size (", window.size(), ") must match input size (", input.size(), ") ",
+                "and output size (", output.size(), ")"
+            )
+        );
+    }
+    const size_t size = window.size();
+    for (size_t i = 0; i < size; ++i) {
+        output[i] = input[i] * window[i];
+    }
+}
+
+template <typename T>
+static constexpr float conversionFactor() noexcept {
+    if constexpr (std::is_same_v<T, int16_t>) {
+        return 1.0F / 32768.0F;
+    } else if constexpr (std::is_same_v<T, int32_t>) {
+        return 1.0F / 2147483648.0F;
+    } else {
+        return 1.0F;
+    }
+}
+
+template <typename T>
+static float convert(T sample) noexcept {
+    if constexpr (std::is_same_v<T, float>) {
+        return sample;
+    } else {
+        return static_cast<float>(sample) * conversionFactor<T>();
+    }
+}
+
+// NOLINTBEGIN(*pointer-arithmetic)
+
+/**
+ * Kernel for small channel counts (known at compile time): the loop over the frames reads the
+ * interleaved input once with a constant stride, which the compiler vectorises (load + shuffle).
+ */
+template <size_t ChannelCount, bool Windowed, typename T>
+static void deinterleaveFixed(const T* input, const float* window, float* const* outputs, size_t frames) {
+    float* out[ChannelCount];  // NOLINT(*avoid-c-arrays)
+    for (size_t c = 0; c < ChannelCount; ++c) {
+        out[c] = outputs[c];
+    }
+    for (size_t i = 0; i < frames; ++i) {
+        const float gain = Windowed ? window[i] : 1.0F;
+        for (size_t c = 0; c < ChannelCount; ++c) {
+            out[c][i] = convert(input[i * ChannelCount + c]) * gain;
+        }
+    }
+}
+
+/**
+ * Kernel for any channel count: the frames are processed in tiles, which stay in the L1 cache
+ * while each channel of the tile is written with contiguous (vectorised) stores.
+ * Faster than interleaved stores to many output streams.
+ */
+template <bool Windowed, typename T>
+static void deinterleaveTiled(
+    const T* input, const float* window, float* const* outputs, size_t stride, size_t count, size_t frames
+) {
+    constexpr size_t tileFrames = 512;
+    for (size_t first = 0; first < frames; first += tileFrames) {
+        const size_t n = std::min(tileFrames, frames - first);
+        for (size_t c = 0; c < count; ++c) {
+            float*   out = outputs[c] + first;
+            const T* in  = input + first * stride + c;
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = convert(in[i * stride]) * (Windowed ? window[first + i] : 1.0F);
+            }
+        }
+    }
+}
+
+// NOLINTEND(*pointer-arithmetic)
+
+template <bool Windowed, typename T>
+static void deinterleaveDispatch(
+    const T* input, const float* window, float* const* outputs, size_t stride, size_t count, size_t frames
+) {
+    if (stride == 1) {
+        return deinterleaveFixed<1, Windowed>(input, window, outputs, frames);
+    }
+    if (stride == 2 && count == 2) {
+        return deinterleaveFixed<2, Windowed>(input, window, outputs, frames);
+    }
+    return deinterleaveTiled<Windowed>(input, window, outputs, stride, count, frames);
+}
+
+template <typename T>
+static void deinterleaveWindowImpl(
+    std::span<const T> interleaved, std::span<const float> window, std::span<const std::span<float>> channels
+) {
+    const size_t channelCount = channels.size();
+    if (channelCount == 0) {
+        throw std::invalid_argument("Channel count must be greater than zero");
+    }
+    if (interleaved.size() % channelCount != 0) {
+        throw std::invalid_argument(
+            helper::concat("Number of samples must be a multiple of the channel count (", channelCount, ")")
+        );
+    }
+    const size_t frames = interleaved.size() / channelCount;
+    if (!window.empty() && window.size() != frames) {
+        throw std::invalid_argument(
+            helper::concat("Window size (", window.size(), ") must match the number of frames (", frames, ")")
+        );
+    }
+
+    constexpr size_t maxChannelCount = 64;  // pointers on the stack, larger counts are processed in groups
+    float*           outputs[maxChannelCount];  // NOLINT(*avoid-c-arrays)
+
+    for (size_t first = 0; first < channelCount; first += maxChannelCount) {
+        const size_t count = std::min(maxChannelCount, channelCount - first);
+        for (size_t c = 0; c < count; ++c) {
+            if (channels[first + c].size() != frames) {
+                throw std::invalid_argument(
+                    helper::concat("Output size of channel ", first + c, " must match the number of frames (", frames, ")")
+                );
+            }
+            outputs[c] = channels[first + c].data();
+        }
+        const T* input = interleaved.data() + first;  // NOLINT(*pointer-arithmetic)
+        if (window.empty()) {
+            deinterleaveDispatch<false>(input, nullptr, outputs, channelCount, count, frames);
+        } else {
+            deinterleaveDispatch<true>(input, window.data(), outputs, channelCount, count, frames);
+        }
+    }
+}
+
+void deinterleaveWindow(
+    std::span<const float> interleaved, std::span<const float> window, std::span<const std::span<float>> channels
+) {
+    deinterleaveWindowImpl(interleaved, window, channels);
+}
+
+void deinterleaveWindow(
+    std::span<const int16_t> interleaved, std::span<const float> window, std::span<const std::span<float>> channels
+) {
+    deinterleaveWindowImpl(interleaved, window, channels);
+}
+
+void deinterleaveWindow(
+    std::span<const int32_t> interleaved, std::span<const float> window, std::span<const std::span<float>> channels
+) {
+    deinterleaveWindowImpl(interleaved, window, channels);
+}
+
+}  // namespace rtvamp::hostsdk
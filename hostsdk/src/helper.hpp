@@ -1,9 +1,19 @@
 #pragma once
 
+#include <algorithm>  // min
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
 #include <functional>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace rtvamp::hostsdk::helper {
 
@@ -14,6 +24,30 @@ std::string concat(Ts const&... ts){
     return s.str();
 }
 
+inline const char* notNull(const char* str) noexcept {
+    return str != nullptr ? str : "";
+}
+
+constexpr std::string_view getPluginExtension() noexcept {
+#if defined(__APPLE__)
+    return ".dylib";
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+    return ".so";
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+    return ".dll";
+#else
+    return "";
+#endif
+}
+
+/**
+ * Check if directory entry is a regular file with the platform specific library extension.
+ */
+inline bool isLibraryCandidate(const std::filesystem::directory_entry& entry) {
+    std::error_code ec;
+    return entry.is_regular_file(ec) && entry.path().extension() == getPluginExtension();
+}
+
 /**
  * General-purpose scope guard intended to call its exit function when a scope is exited.
  * @see https://en.cppreference.com/w/cpp/experimental/scope_exit
@@ -52,4 +86,72 @@ private:
     bool active_{true};
 };
 
+/**
+ * Exact timestamp of a sample position in nanoseconds.
+ * Integer arithmetic for integer sample rates, therefore timestamps do not drift on long signals.
+ */
+inline uint64_t getTimestamp(uint64_t samplePosition, float sampleRate) noexcept {
+    constexpr uint64_t nsecPerSec = 1'000'000'000;
+    if (sampleRate > 0.0F && sampleRate == std::floor(sampleRate)) {
+        // exact integer arithmetic without overflow: remainder * 1e9 < 2^32 * 1e9 < 2^64
+        const auto rate = static_cast<uint64_t>(sampleRate);
+        return (samplePosition / rate) * nsecPerSec + (samplePosition % rate) * nsecPerSec / rate;
+    }
+    if (sampleRate > 0.0F) {
+        return static_cast<uint64_t>(std::llround(
+            static_cast<long double>(samplePosition) * nsecPerSec / sampleRate
+        ));
+    }
+    return 0;
+}
+
+/**
+ * Invoke `fn(index)` for every index in [0, count) on a bounded number of worker threads.
+ * Indices are distributed dynamically to balance uneven workloads. The number of threads is
+ * limited to `count`, zero selects the hardware concurrency. If `fn` throws, no further indices
+ * are started and the first exception is rethrown after all workers finished.
+ */
+template <typename Fn>
+void parallelFor(size_t count, unsigned int threads, Fn&& fn) {
+    if (threads == 0) {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    const auto workerCount = std::min<size_t>(threads, count);
+    if (workerCount <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            std::invoke(fn, i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::mutex          exceptionMutex;
+    std::exception_ptr  exception;
+    const auto worker = [&] {
+        try {
+            for (size_t i = next++; i < count; i = next++) {
+                std::invoke(fn, i);
+            }
+        } catch (...) {
+            next = count;  // stop other workers
+            const std::lock_guard lock(exceptionMutex);
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(workerCount - 1);
+        for (size_t i = 1; i < workerCount; ++i) {
+            workers.emplace_back(worker);
+        }
+        worker();  // use calling thread as well
+    }  // join workers
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
 }  // namespace rtvamp::hostsdk::helper
@@ -3,26 +3,17 @@
 #include <cassert>
 #include <optional>
 #include <set>
+#include <utility>  // move
 
 #include "vamp/vamp.h"
 
 #include "DynamicLibrary.hpp"
+#include "LibraryProbe.hpp"
+#include "PluginLibraryAccess.hpp"
 #include "helper.hpp"
 
 namespace rtvamp::hostsdk {
 
-static constexpr std::string_view getPluginExtension() noexcept {
-#if defined(__APPLE__)
-    return ".dylib";
-#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-    return ".so";
-#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-    return ".dll";
-#else
-    return "";
-#endif
-}
-
 PathList getVampPaths() {
     using std::filesystem::path;
     std::vector<path> result;
@@ -52,23 +43,7 @@ PathList getVampPaths() {
 }
 
 bool isVampLibrary(const std::filesystem::path& libraryPath) {
-    DynamicLibrary dl;
-    if (!dl.load(libraryPath)) {
-        return false;
-    }
-    if (dl.getFunction<VampGetPluginDescriptorFunction>("vampGetPluginDescriptor") == nullptr) {
-        return false;
-    }
-    return true;
-}
-
-static bool isVampLibrary(const std::filesystem::directory_entry& entry) {
-    std::error_code ec;
-    return (
-        entry.is_regular_file(ec) &&
-        entry.path().extension() == getPluginExtension() &&
-        isVampLibrary(entry.path())
-    );
+    return openVampLibrary(libraryPath) != nullptr;
 }
 
 PathList listLibraries() {
@@ -76,20 +51,30 @@ PathList listLibraries() {
     return listLibraries(paths);
 }
 
-PathList listLibraries(const std::filesystem::path& path) {
+static std::vector<std::filesystem::path> listLibraryCandidates(const std::filesystem::path& path) {
     std::error_code ec;  // for noexcept versions
     if (!std::filesystem::is_directory(path, ec)) {
         return {};
     }
     std::vector<std::filesystem::path> result;
     for (auto&& entry : std::filesystem::recursive_directory_iterator(path, ec)) {
-        if (isVampLibrary(entry)) {
+        if (helper::isLibraryCandidate(entry)) {
             result.push_back(entry.path());
         }
     }
     return result;
 }
 
+PathList listLibraries(const std::filesystem::path& path) {
+    std::vector<std::filesystem::path> result;
+    for (auto&& candidate : listLibraryCandidates(path)) {
+        if (isVampLibrary(candidate)) {
+            result.push_back(candidate);
+        }
+    }
+    return result;
+}
+
 PathList listLibraries(std::span<const std::filesystem::path> paths) {
     std::set<std::filesystem::path> result;  // use set to avoid duplicates (paths may have duplicates)
     for (auto&& path : paths) {
@@ -99,6 +84,32 @@ PathList listLibraries(std::span<const std::filesystem::path> paths) {
     return {result.begin(), result.end()};
 }
 
+PathList listLibraries(std::span<const std::filesystem::path> paths, const DiscoveryOptions& options) {
+    std::set<std::filesystem::path> candidates;  // use set to avoid duplicates (paths may have duplicates)
+    for (auto&& path : paths) {
+        const auto libraries = listLibraryCandidates(path);
+        candidates.insert(libraries.begin(), libraries.end());
+    }
+
+    const std::vector<std::filesystem::path> candidatesList(candidates.begin(), candidates.end());
+    std::vector<char> valid(candidatesList.size(), 0);  // no vector<bool>, elements are written concurrently
+    helper::parallelFor(candidatesList.size(), options.threads, [&](size_t i) {
+        try {
+            valid[i] = static_cast<char>(isVampLibrary(candidatesList[i]));
+        } catch (...) {
+            valid[i] = 0;  // a single bad candidate is no Vamp library
+        }
+    });
+
+    PathList result;
+    for (size_t i = 0; i < candidatesList.size(); ++i) {
+        if (valid[i] != 0) {
+            result.push_back(candidatesList[i]);
+        }
+    }
+    return result;
+}
+
 PluginLibrary loadLibrary(const std::filesystem::path& libraryPath) {
     return PluginLibrary(libraryPath);
 }
@@ -110,7 +121,11 @@ std::vector<PluginKey> listPlugins() {
 
 static std::vector<PluginKey> listPluginsInLibrary(const std::filesystem::path& path) {
     try {
-        const auto library = loadLibrary(path);
+        auto dl = openVampLibrary(path);  // load library only once
+        if (dl == nullptr) {
+            return {};
+        }
+        const auto library = PluginLibraryAccess::create(std::move(dl));
         return library.listPlugins();
     } catch (...) {
         return {};
@@ -119,7 +134,7 @@ static std::vector<PluginKey> listPluginsInLibrary(const std::filesystem::path&
 
 static std::vector<PluginKey> listPluginsInDirectory(const std::filesystem::path& path) {
     std::vector<PluginKey> result;
-    for (auto&& libraryPath : listLibraries(path)) {
+    for (auto&& libraryPath : listLibraryCandidates(path)) {
         const auto plugins = listPluginsInLibrary(libraryPath);
         result.insert(result.end(), plugins.begin(), plugins.end());
     }
@@ -146,42 +161,73 @@ std::vector<PluginKey> listPlugins(std::span<const std::filesystem::path> paths)
     return {result.begin(), result.end()};
 }
 
-static std::optional<std::filesystem::path> findLibrary(std::string_view stem) {
+std::vector<PluginKey> listPlugins(std::span<const std::filesystem::path> paths, const DiscoveryOptions& options) {
+    std::set<std::filesystem::path> candidates;  // use set to avoid duplicates (paths may have duplicates)
+    for (auto&& path : paths) {
+        std::error_code ec;
+        if (std::filesystem::is_directory(path, ec)) {
+            const auto libraries = listLibraryCandidates(path);
+            candidates.insert(libraries.begin(), libraries.end());
+        } else if (std::filesystem::is_regular_file(path, ec)) {
+            candidates.insert(path);
+        }
+    }
+
+    const std::vector<std::filesystem::path> candidatesList(candidates.begin(), candidates.end());
+    std::vector<std::vector<PluginKey>> plugins(candidatesList.size());
+    helper::parallelFor(candidatesList.size(), options.threads, [&](size_t i) {
+        plugins[i] = listPluginsInLibrary(candidatesList[i]);
+    });
+
+    std::set<PluginKey> result;  // merge in deterministic order
+    for (auto&& libraryPlugins : plugins) {
+        result.insert(libraryPlugins.begin(), libraryPlugins.end());
+    }
+    return {result.begin(), result.end()};
+}
+
+static std::shared_ptr<DynamicLibrary> findLibrary(std::string_view stem) {
     std::error_code ec;
     for (auto&& path : getVampPaths()) {
         for (auto&& entry : std::filesystem::recursive_directory_iterator(path, ec)) {
-            if (isVampLibrary(entry) && entry.path().stem() == stem) {
-                return entry.path();
+            if (entry.path().stem() != stem || !helper::isLibraryCandidate(entry)) {
+                continue;  // check cheap conditions first
+            }
+            if (auto dl = openVampLibrary(entry.path())) {
+                return dl;
             }
         }
     }
-    return std::nullopt;
+    return nullptr;
 }
 
-static std::optional<std::filesystem::path> findLibrary(std::string_view stem, std::span<const std::filesystem::path> libraryPaths) {
+static std::shared_ptr<DynamicLibrary> findLibrary(std::string_view stem, std::span<const std::filesystem::path> libraryPaths) {
     for (auto&& libraryPath : libraryPaths) {
-        if (isVampLibrary(libraryPath) && libraryPath.stem() == stem) {
-            return libraryPath;
+        if (libraryPath.stem() != stem) {
+            continue;
+        }
+        if (auto dl = openVampLibrary(libraryPath)) {
+            return dl;
         }
     }
-    return std::nullopt;
+    return nullptr;
 }
 
 std::unique_ptr<Plugin> loadPlugin(const PluginKey& key, float inputSampleRate) {
-    const auto libraryPath = findLibrary(key.getLibrary());
-    if (!libraryPath) {
+    auto dl = findLibrary(key.getLibrary());
+    if (dl == nullptr) {
         throw std::invalid_argument(helper::concat("Plugin not found: ", key.get()));
     }
-    const auto library = loadLibrary(libraryPath.value());
+    const auto library = PluginLibraryAccess::create(std::move(dl));
     return library.loadPlugin(key, inputSampleRate);
 }
 
 std::unique_ptr<Plugin> loadPlugin(const PluginKey& key, float inputSampleRate, std::span<const std::filesystem::path> paths) {
-    const auto libraryPath = findLibrary(key.getLibrary(), paths);
-    if (!libraryPath) {
+    auto dl = findLibrary(key.getLibrary(), paths);
+    if (dl == nullptr) {
         throw std::invalid_argument(helper::concat("Plugin not found: ", key.get()));
     }
-    const auto library = loadLibrary(libraryPath.value());
+    const auto library = PluginLibraryAccess::create(std::move(dl));
     return library.loadPlugin(key, inputSampleRate);
 }
 
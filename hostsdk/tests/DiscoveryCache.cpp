@@ -0,0 +1,150 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+
+#include "rtvamp/hostsdk.hpp"
+
+#include "config.hpp"
+#include "helper.hpp"
+
+using Catch::Matchers::Contains;
+using rtvamp::hostsdk::DiscoveryCache;
+using rtvamp::hostsdk::Plugin;
+using rtvamp::hostsdk::PluginKey;
+
+TEST_CASE("DiscoveryCache") {
+    const std::vector<std::filesystem::path> paths{searchPath};
+
+    SECTION("Default cache path") {
+        const auto path = DiscoveryCache::getDefaultCachePath();
+        CHECK_FALSE(path.empty());
+    }
+
+    SECTION("Invalid path") {
+        DiscoveryCache cache;
+        CHECK_FALSE(cache.getLibraryInfo("nonexistinglibrary.so"));
+        CHECK(cache.listLibraries(std::vector<std::filesystem::path>{"thisshouldbeaninvalidpath"}).empty());
+    }
+
+    SECTION("Library info") {
+        DiscoveryCache cache;
+        CHECK_FALSE(cache.getLibraryInfo(getLibraryPath("invalid-plugin")));
+
+        const auto info = cache.getLibraryInfo(getLibraryPath("example-plugin"));
+        REQUIRE(info);
+        CHECK(info->name == "example-plugin");
+        REQUIRE(info->plugins.size() >= 2);
+        CHECK(info->plugins[0].identifier == "rms");
+        CHECK(info->plugins[0].name == "RMS");
+        CHECK(info->plugins[0].inputDomain == Plugin::InputDomain::Time);
+        CHECK(info->plugins[1].identifier == "spectralrolloff");
+        CHECK(info->plugins[1].inputDomain == Plugin::InputDomain::Frequency);
+    }
+
+    SECTION("Match uncached discovery") {
+        DiscoveryCache cache;
+        CHECK(cache.listLibraries(paths) == rtvamp::hostsdk::listLibraries(paths));
+        CHECK(cache.listPlugins(paths) == rtvamp::hostsdk::listPlugins(paths));
+
+        const auto libraryPath = getLibraryPath("example-plugin");
+        CHECK(cache.listPlugins(std::vector{libraryPath}) == rtvamp::hostsdk::listPlugins(libraryPath));
+    }
+
+    SECTION("Warm in-memory cache") {
+        DiscoveryCache cache;
+        const auto cold = cache.listPlugins(paths);
+        REQUIRE_THAT(cold, Contains(PluginKey("example-plugin:rms")));
+        const auto misses = cache.getStatistics().misses;
+        CHECK(misses > 0);
+
+        const auto warm = cache.listPlugins(paths);
+        CHECK(warm == cold);
+        CHECK(cache.getStatistics().misses == misses);
+        CHECK(cache.getStatistics().hits > 0);
+
+        CHECK(cache.findLibrary("example-plugin") == getLibraryPath("example-plugin"));
+        CHECK_FALSE(cache.findLibrary("invalid-plugin"));
+        CHECK_FALSE(cache.findLibrary("unknown"));
+    }
+
+    SECTION("Persistent cache") {
+        const auto cacheFile = std::filesystem::temp_directory_path() / "rtvamp-tests" / "discovery.cache";
+        std::filesystem::remove(cacheFile);
+
+        std::vector<PluginKey> cold;
+        {
+            DiscoveryCache cache(cacheFile);
+            cold = cache.listPlugins(paths);
+            CHECK(cache.getStatistics().misses > 0);
+            REQUIRE(cache.save());
+        }
+        REQUIRE(std::filesystem::exists(cacheFile));
+        {
+            DiscoveryCache cache(cacheFile);
+            CHECK(cache.getCachePath() == cacheFile);
+            CHECK(cache.listPlugins(paths) == cold);
+            CHECK(cache.getStatistics().misses == 0);  // no library loaded
+            CHECK(cache.getStatistics().hits > 0);
+
+            const auto info = cache.getLibraryInfo(getLibraryPath("example-plugin"));
+            REQUIRE(info);
+            CHECK(info->plugins[1].identifier == "spectralrolloff");
+            CHECK(info->plugins[1].inputDomain == Plugin::InputDomain::Frequency);
+        }
+
+        SECTION("Invalid cache file") {
+            std::filesystem::resize_file(cacheFile, 10);
+            DiscoveryCache cache(cacheFile);
+            CHECK(cache.listPlugins(paths) == cold);
+            CHECK(cache.getStatistics().hits == 0);
+        }
+
+        SECTION("Corrupt string size") {
+            // size of the first path (after magic, version and entry count)
+            std::fstream file(cacheFile, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(8 + sizeof(uint32_t) + sizeof(uint64_t));
+            const uint32_t size = 0xFFFFFFF0;
+            file.write(reinterpret_cast<const char*>(&size), sizeof(size));  // NOLINT
+            file.close();
+
+            DiscoveryCache cache(cacheFile);
+            CHECK(cache.listPlugins(paths) == cold);
+            CHECK(cache.getStatistics().hits == 0);
+        }
+
+        std::filesystem::remove(cacheFile);
+    }
+
+    SECTION("Prune removed libraries") {
+        const auto directory = std::filesystem::temp_directory_path() / "rtvamp-tests" / "prune";
+        const auto cacheFile = directory / "discovery.cache";
+        const auto extension = getLibraryPath("example-plugin").extension().string();
+        const auto library   = directory / "libs" / ("copied-plugin" + extension);
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(library.parent_path());
+        std::filesystem::copy_file(getLibraryPath("example-plugin"), library);
+        {
+            DiscoveryCache cache(cacheFile);
+            cache.listPlugins(std::vector{library.parent_path(), searchPath});
+            REQUIRE(cache.findLibrary("copied-plugin"));
+            REQUIRE(cache.save());
+        }
+        std::filesystem::remove_all(library.parent_path());
+        {
+            DiscoveryCache cache(cacheFile);
+            CHECK(cache.findLibrary("copied-plugin"));  // not checked before save
+            CHECK(cache.findLibrary("example-plugin"));
+            REQUIRE(cache.save());
+        }
+        {
+            DiscoveryCache cache(cacheFile);
+            CHECK_FALSE(cache.findLibrary("copied-plugin"));
+            CHECK(cache.findLibrary("example-plugin"));  // unchanged, kept
+        }
+        std::filesystem::remove_all(directory);
+    }
+}
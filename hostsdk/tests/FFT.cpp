@@ -0,0 +1,93 @@
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <numbers>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "rtvamp/hostsdk/FFT.hpp"
+
+using Catch::Approx;
+using rtvamp::hostsdk::FFT;
+
+static std::vector<std::complex<double>> referenceDFT(const std::vector<float>& input) {
+    const size_t size = input.size();
+    std::vector<std::complex<double>> output(size / 2 + 1);
+    for (size_t k = 0; k < output.size(); ++k) {
+        for (size_t n = 0; n < size; ++n) {
+            const double phase = -2.0 * std::numbers::pi * static_cast<double>(k * n) / static_cast<double>(size);
+            output[k] += static_cast<double>(input[n]) * std::polar(1.0, phase);
+        }
+    }
+    return output;
+}
+
+TEST_CASE("FFT backends") {
+    const auto backends = rtvamp::hostsdk::listFFTBackends();
+    REQUIRE(!backends.empty());
+    REQUIRE(backends.back() == "builtin");
+    CHECK(rtvamp::hostsdk::getFFTBackend().getName() == backends.front());
+    CHECK(rtvamp::hostsdk::getFFTBackend("builtin").getName() == "builtin");
+    CHECK_THROWS_AS(rtvamp::hostsdk::getFFTBackend("unknown"), std::invalid_argument);
+}
+
+TEST_CASE("FFT") {
+    const auto backendName = GENERATE(from_range(rtvamp::hostsdk::listFFTBackends()));
+    const auto& backend    = rtvamp::hostsdk::getFFTBackend(backendName);
+
+    SECTION("Compare with reference DFT") {
+        const size_t size = GENERATE(1, 2, 3, 4, 6, 8, 15, 64, 100, 1000, 1023, 1024, 4096);
+        CAPTURE(backendName, size);
+
+        std::vector<float> input(size);
+        for (size_t i = 0; i < size; ++i) {
+            input[i] = std::sin(0.3F * static_cast<float>(i)) + ((i % 3 == 0) ? 0.5F : -0.25F);
+        }
+
+        FFT fft(size, backend);
+        REQUIRE(fft.getSize() == size);
+        REQUIRE(fft.getBinCount() == size / 2 + 1);
+        REQUIRE(&fft.getBackend() == &backend);
+
+        const auto output   = fft.compute(input);
+        const auto expected = referenceDFT(input);
+        REQUIRE(output.size() == expected.size());
+        // error grows with the FFT size (float precision)
+        const double margin = 1e-5 * static_cast<double>(size) + 1e-4;
+        for (size_t k = 0; k < output.size(); ++k) {
+            CAPTURE(k);
+            CHECK(output[k].real() == Approx(expected[k].real()).margin(margin));
+            CHECK(output[k].imag() == Approx(expected[k].imag()).margin(margin));
+        }
+
+        // compute into caller-provided buffer
+        std::vector<std::complex<float>> outputExternal(fft.getBinCount());
+        fft.compute(input, outputExternal);
+        for (size_t k = 0; k < output.size(); ++k) {
+            CHECK(outputExternal[k] == output[k]);
+        }
+    }
+
+    SECTION("Aligned output buffer") {
+        FFT fft(256, backend);
+        const std::vector<float> input(256);
+        const auto output = fft.compute(input);
+        CHECK(reinterpret_cast<uintptr_t>(output.data()) % 64 == 0);  // NOLINT(*reinterpret-cast)
+    }
+
+    SECTION("Invalid sizes") {
+        CHECK_THROWS_AS(FFT(0, backend), std::invalid_argument);
+
+        FFT fft(8, backend);
+        std::vector<float>               input(8);
+        std::vector<std::complex<float>> output(5);
+        CHECK_THROWS_AS(fft.compute(std::vector<float>(7)), std::invalid_argument);
+        CHECK_THROWS_AS(fft.compute(input, std::span(output).first(4)), std::invalid_argument);
+        CHECK_NOTHROW(fft.compute(input, output));
+    }
+}
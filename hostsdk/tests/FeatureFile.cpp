@@ -0,0 +1,199 @@
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>  // istreambuf_iterator
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "rtvamp/hostsdk/FeatureFile.hpp"
+
+#include "helper.hpp"
+
+using rtvamp::hostsdk::FeatureFileReader;
+using rtvamp::hostsdk::FeatureFileWriter;
+using rtvamp::hostsdk::Plugin;
+
+static std::vector<Plugin::OutputDescriptor> createOutputs() {
+    std::vector<Plugin::OutputDescriptor> outputs(2);
+    outputs[0].identifier = "rms";
+    outputs[0].name       = "RMS";
+    outputs[0].unit       = "V";
+    outputs[0].binCount   = 1;
+    outputs[1].identifier = "spectrum";
+    outputs[1].name       = "Spectrum";
+    outputs[1].binCount   = 3;
+    return outputs;
+}
+
+TEST_CASE("FeatureFile") {
+    const auto directory = std::filesystem::temp_directory_path() / "rtvamp-tests";
+    const auto path      = directory / "features.rtvfeat";
+    std::filesystem::create_directories(directory);
+    std::filesystem::remove(path);
+
+    const auto outputs = createOutputs();
+
+    SECTION("Round trip") {
+        constexpr size_t rows = 1000;
+        {
+            FeatureFileWriter writer(path, "example-plugin:rms", outputs, 48000.0F, 512, 1024);
+            CHECK(writer.getOutputCount() == 2);
+
+            // mixed write methods
+            std::vector<Plugin::Feature> featureSet{{0.0F}, {0.0F, 0.0F, 0.0F}};
+            std::vector<float>           matrix;
+            for (size_t row = 0; row < rows; ++row) {
+                const auto value = static_cast<float>(row);
+                if (row < rows / 2) {
+                    featureSet[0] = {value};
+                    featureSet[1] = {value, value + 0.25F, value + 0.5F};
+                    writer.write(Plugin::FeatureSet(featureSet));
+                } else {
+                    matrix.insert(matrix.end(), {value, value, value + 0.25F, value + 0.5F});
+                }
+            }
+            writer.writeMatrix(matrix);
+            CHECK(writer.getRowCount() == rows);
+            writer.close();
+            CHECK_THROWS_AS(writer.writeMatrix(matrix), std::logic_error);
+            writer.close();  // no-op
+        }
+
+        const FeatureFileReader reader(path);
+        CHECK(reader.getPluginKey() == "example-plugin:rms");
+        CHECK(reader.getSampleRate() == 48000.0F);
+        CHECK(reader.getStepSize() == 512);
+        CHECK(reader.getBlockSize() == 1024);
+        CHECK(reader.getRowCount() == rows);
+        REQUIRE(reader.getOutputs().size() == 2);
+        CHECK(reader.getOutputs()[0].identifier == "rms");
+        CHECK(reader.getOutputs()[0].name == "RMS");
+        CHECK(reader.getOutputs()[0].unit == "V");
+        CHECK(reader.getOutputs()[0].binCount == 1);
+        CHECK(reader.getOutputs()[1].identifier == "spectrum");
+        CHECK(reader.getOutputs()[1].unit.empty());
+        CHECK(reader.getOutputs()[1].binCount == 3);
+
+        const auto rms      = reader.getFeatures(0);
+        const auto spectrum = reader.getFeatures(1);
+        REQUIRE(rms.size() == rows);
+        REQUIRE(spectrum.size() == rows * 3);
+        CHECK(reinterpret_cast<uintptr_t>(spectrum.data()) % 64 == 0);  // NOLINT
+        for (size_t row = 0; row < rows; ++row) {
+            const auto value = static_cast<float>(row);
+            CHECK(rms[row] == value);
+            CHECK(spectrum[row * 3] == value);
+            CHECK(spectrum[row * 3 + 1] == value + 0.25F);
+            CHECK(spectrum[row * 3 + 2] == value + 0.5F);
+        }
+        CHECK_THROWS_AS(reader.getFeatures(2), std::out_of_range);
+
+        CHECK(reader.getTimestamp(0) == 0);
+        CHECK(reader.getTimestamp(3) == 32'000'000);  // 3 * 512 / 48000 s
+    }
+
+    SECTION("Feature views") {
+        {
+            FeatureFileWriter writer(path, "key", outputs, 8000.0F, 80, 80);
+            const std::array<float, 1>       rms{1.0F};
+            const std::array<float, 3>       spectrum{2.0F, 3.0F, 4.0F};
+            const std::array<Plugin::FeatureView, 2> views{rms, spectrum};
+            writer.write(Plugin::FeatureViewSet(views));
+            CHECK(writer.getRowCount() == 1);
+        }  // closed by destructor
+
+        const FeatureFileReader reader(path);
+        REQUIRE(reader.getRowCount() == 1);
+        CHECK(reader.getFeatures(0)[0] == 1.0F);
+        CHECK(reader.getFeatures(1)[2] == 4.0F);
+        CHECK(reader.getTimestamp(1) == 10'000'000);
+    }
+
+    SECTION("No rows") {
+        FeatureFileWriter(path, "key", outputs, 44100.0F, 256, 512).close();
+        const FeatureFileReader reader(path);
+        CHECK(reader.getRowCount() == 0);
+        CHECK(reader.getOutputs().size() == 2);
+        CHECK(reader.getFeatures(1).empty());
+    }
+
+    SECTION("Move assignment closes the current file") {
+        const auto otherPath = directory / "features-other.rtvfeat";
+        FeatureFileWriter writer(path, "key", outputs, 8000.0F, 80, 80);
+        writer.writeMatrix(std::vector<float>(4 * 10));
+        writer = FeatureFileWriter(otherPath, "other", outputs, 8000.0F, 80, 80);
+
+        const FeatureFileReader reader(path);
+        CHECK(reader.getPluginKey() == "key");
+        CHECK(reader.getRowCount() == 10);
+        CHECK(writer.getRowCount() == 0);
+        writer.writeMatrix(std::vector<float>(4));
+        writer.close();
+        CHECK(FeatureFileReader(otherPath).getRowCount() == 1);
+    }
+
+    SECTION("Reference file of the Python tests") {
+        // python/tests/test_featurefile.py reads the same file, keep both in sync
+        {
+            FeatureFileWriter writer(path, "example-plugin:rms", outputs, 48000.0F, 512, 1024);
+            std::vector<float> matrix;
+            for (size_t row = 0; row < 4; ++row) {
+                const auto value = static_cast<float>(row);
+                matrix.insert(matrix.end(), {value, value, value + 0.25F, value + 0.5F});
+            }
+            writer.writeMatrix(matrix);
+        }
+        const auto readFile = [](const std::filesystem::path& p) {
+            std::ifstream file(p, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(file), {});
+        };
+        const auto reference = sourcePath / "python" / "tests" / "data" / "features.rtvfeat";
+        REQUIRE(std::filesystem::exists(reference));
+        CHECK(readFile(path) == readFile(reference));
+    }
+
+    SECTION("Invalid features") {
+        FeatureFileWriter writer(path, "key", outputs, 44100.0F, 256, 512);
+
+        const std::vector<Plugin::Feature> tooFewOutputs{{1.0F}};
+        CHECK_THROWS_AS(writer.write(Plugin::FeatureSet(tooFewOutputs)), std::invalid_argument);
+
+        const std::vector<Plugin::Feature> wrongBinCount{{1.0F}, {1.0F, 2.0F}};
+        CHECK_THROWS_AS(writer.write(Plugin::FeatureSet(wrongBinCount)), std::invalid_argument);
+
+        const std::vector<float> matrix(6);
+        CHECK_THROWS_AS(writer.writeMatrix(matrix), std::invalid_argument);
+        CHECK(writer.getRowCount() == 0);
+    }
+
+    SECTION("Output without fixed bin count") {
+        auto variableOutputs = createOutputs();
+        variableOutputs[1].hasFixedBinCount = false;
+        CHECK_THROWS_AS(
+            FeatureFileWriter(path, "key", variableOutputs, 44100.0F, 256, 512), std::invalid_argument
+        );
+    }
+
+    SECTION("Invalid files") {
+        CHECK_THROWS_AS(FeatureFileReader(directory / "missing.rtvfeat"), std::runtime_error);
+
+        std::ofstream(path) << "not a feature file";
+        CHECK_THROWS_AS(FeatureFileReader(path), std::runtime_error);
+
+        // truncated feature data
+        std::filesystem::remove(path);
+        {
+            FeatureFileWriter writer(path, "key", outputs, 44100.0F, 256, 512);
+            const std::vector<float> matrix(4 * 100);
+            writer.writeMatrix(matrix);
+        }
+        CHECK_NOTHROW(FeatureFileReader(path));
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+        CHECK_THROWS_AS(FeatureFileReader(path), std::runtime_error);
+    }
+}
@@ -0,0 +1,86 @@
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#if defined(__linux__)
+#include <elf.h>
+#endif
+
+#include "DynamicLibrary.hpp"
+#include "LibraryProbe.hpp"
+
+#include "config.hpp"
+#include "helper.hpp"
+
+using rtvamp::hostsdk::hasDynamicSymbol;
+using rtvamp::hostsdk::openVampLibrary;
+
+TEST_CASE("hasDynamicSymbol") {
+    const char* symbol = "vampGetPluginDescriptor";
+
+    SECTION("Non-existing library") {
+        CHECK_FALSE(hasDynamicSymbol("nonexistinglibrary.so", symbol).has_value());
+    }
+
+    SECTION("No library") {
+        CHECK_FALSE(hasDynamicSymbol(searchPath / "../CMakeCache.txt", symbol).has_value());
+    }
+
+#if defined(__linux__)
+    SECTION("Library without symbol") {
+        CHECK(hasDynamicSymbol(getLibraryPath("invalid-plugin"), symbol) == false);
+    }
+
+    SECTION("Library with symbol") {
+        CHECK(hasDynamicSymbol(getLibraryPath("example-plugin"), symbol) == true);
+        CHECK(hasDynamicSymbol(getLibraryPath("example-plugin"), "vampGetPluginDescriptorX") == false);
+    }
+
+    SECTION("Corrupt library") {
+        std::ifstream     input(getLibraryPath("example-plugin"), std::ios::binary);
+        std::vector<char> data(std::istreambuf_iterator<char>(input), {});
+        const auto        path = std::filesystem::temp_directory_path() / "rtvamp-tests" / "corrupt.so";
+        std::filesystem::create_directories(path.parent_path());
+        const auto write = [&] {
+            std::ofstream(path, std::ios::binary).write(data.data(), static_cast<std::streamsize>(data.size()));
+        };
+
+        SECTION("Truncated") {
+            data.resize(data.size() / 2);
+            write();
+            CHECK_FALSE(hasDynamicSymbol(path, symbol).has_value());
+        }
+
+        SECTION("Section sizes exceed file size") {
+            Elf64_Ehdr header{};
+            std::memcpy(&header, data.data(), sizeof(header));
+            REQUIRE(header.e_ident[EI_CLASS] == ELFCLASS64);
+            for (size_t i = 0; i < header.e_shnum; ++i) {
+                Elf64_Shdr section{};
+                char*      ptr = data.data() + header.e_shoff + i * sizeof(section);
+                std::memcpy(&section, ptr, sizeof(section));
+                section.sh_size = UINT64_MAX / 2;
+                std::memcpy(ptr, &section, sizeof(section));
+            }
+            write();
+            CHECK_FALSE(hasDynamicSymbol(path, symbol).has_value());
+        }
+    }
+#endif
+}
+
+TEST_CASE("openVampLibrary") {
+    CHECK(openVampLibrary("nonexistinglibrary.so") == nullptr);
+    CHECK(openVampLibrary(getLibraryPath("invalid-plugin")) == nullptr);
+
+    const auto path = getLibraryPath("example-plugin");
+    const auto dl   = openVampLibrary(path);
+    REQUIRE(dl != nullptr);
+    CHECK(dl->isLoaded());
+    CHECK(dl->path() == path);
+}
@@ -0,0 +1,119 @@
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "vamp/vamp.h"
+
+#include "rtvamp/hostsdk/PipelineExecutor.hpp"
+#include "rtvamp/hostsdk/PluginHostAdapter.hpp"
+#include "rtvamp/hostsdk/PluginLibrary.hpp"
+#include "rtvamp/hostsdk/SpectralFrontEnd.hpp"
+
+#include "TestPluginDescriptor.hpp"
+#include "helper.hpp"
+
+using rtvamp::hostsdk::PipelineExecutor;
+using rtvamp::hostsdk::Plugin;
+using rtvamp::hostsdk::PluginHostAdapter;
+using rtvamp::hostsdk::PluginLibrary;
+using rtvamp::hostsdk::SpectralFrontEnd;
+
+static constexpr std::string_view pluginKeys[] = {  // NOLINT(*avoid-c-arrays)
+    "example-plugin:rms",
+    "example-plugin:spectralrolloff",
+};
+
+TEST_CASE("PipelineExecutor") {
+    constexpr uint32_t blockSize   = 256;
+    constexpr uint32_t stepSize    = 128;
+    constexpr size_t   pluginCount = 10;
+    constexpr size_t   blockCount  = 8;
+
+    PluginLibrary library(getLibraryPath("example-plugin"));
+
+    const auto createPlugins = [&] {
+        std::vector<std::unique_ptr<Plugin>> plugins;
+        for (size_t i = 0; i < pluginCount; ++i) {
+            plugins.push_back(library.loadPlugin(pluginKeys[i % std::size(pluginKeys)], 48000));
+        }
+        return plugins;
+    };
+
+    std::vector<float> signal(blockCount * stepSize + blockSize);
+    for (size_t i = 0; i < signal.size(); ++i) {
+        signal[i] = std::sin(0.01F * static_cast<float>(i * i % 1000)) * static_cast<float>(i % 7);
+    }
+
+    // reference: serial processing
+    auto             referencePlugins = createPlugins();
+    SpectralFrontEnd frontEnd(blockSize);
+    for (auto& plugin : referencePlugins) {
+        REQUIRE(plugin->initialise(stepSize, blockSize));
+    }
+    std::vector<std::vector<float>> expected(blockCount);
+    for (size_t block = 0; block < blockCount; ++block) {
+        const auto buffer   = Plugin::TimeDomainBuffer(signal).subspan(block * stepSize, blockSize);
+        const auto spectrum = frontEnd.compute(buffer);
+        for (auto& plugin : referencePlugins) {
+            const bool isTimeDomain = plugin->getInputDomain() == Plugin::InputDomain::Time;
+            expected[block].push_back(plugin->process(isTimeDomain ? Plugin::InputBuffer(buffer) : spectrum, 0)[0][0]);
+        }
+    }
+
+    const unsigned int threads = GENERATE(1U, 2U, 4U, 64U);
+    CAPTURE(threads);
+    PipelineExecutor executor(createPlugins(), threads);
+    REQUIRE(executor.getPluginCount() == pluginCount);
+    REQUIRE(executor.getThreadCount() == std::min<size_t>(threads, pluginCount));
+
+    SECTION("Process before initialise") {
+        CHECK_THROWS_AS(executor.process(Plugin::TimeDomainBuffer(signal).first(blockSize), 0), std::logic_error);
+    }
+
+    SECTION("Features in plugin order") {
+        executor.initialise(stepSize, blockSize);
+        for (int pass = 0; pass < 2; ++pass) {  // same results after reset
+            for (size_t block = 0; block < blockCount; ++block) {
+                const auto features = executor.process(
+                    Plugin::TimeDomainBuffer(signal).subspan(block * stepSize, blockSize), block
+                );
+                REQUIRE(features.size() == pluginCount);
+                for (size_t i = 0; i < pluginCount; ++i) {
+                    CAPTURE(pass, block, i);
+                    CHECK(features[i][0][0] == expected[block][i]);
+                }
+            }
+            executor.reset();
+        }
+    }
+}
+
+TEST_CASE("PipelineExecutor invalid plugins") {
+    std::vector<std::unique_ptr<Plugin>> plugins;
+    plugins.push_back(nullptr);
+    CHECK_THROWS_AS(PipelineExecutor(std::move(plugins)), std::invalid_argument);
+}
+
+TEST_CASE("PipelineExecutor forwards exceptions") {
+    static const auto descriptor = [] {
+        auto d    = TestPluginDescriptor::get();
+        d.process = [](VampPluginHandle, const float* const*, int, int) -> VampFeatureList* { return nullptr; };
+        return d;
+    }();
+
+    std::vector<std::unique_ptr<Plugin>> plugins;
+    for (int i = 0; i < 4; ++i) {
+        plugins.push_back(std::make_unique<PluginHostAdapter>(descriptor, 48000));
+    }
+    PipelineExecutor executor(std::move(plugins), 2);
+    executor.initialise(4, 4);
+
+    const std::vector<float> buffer(4);
+    CHECK_THROWS_AS(executor.process(buffer, 0), std::runtime_error);
+    CHECK_THROWS_AS(executor.process(buffer, 0), std::runtime_error);  // workers still usable
+}
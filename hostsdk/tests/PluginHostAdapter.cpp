@@ -1,4 +1,8 @@
+#include <memory>
 #include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
@@ -25,23 +29,17 @@ TEST_CASE("PluginHostAdapter plugin requirements") {
         );
     }
 
-    SECTION("Min channel count == 1") {
-        descriptor.getMinChannelCount = [](VampPluginHandle) { return 2u; };
-        REQUIRE_THROWS_WITH(
-            PluginHostAdapter(descriptor, 48000),
-            "Minimum channel count > 1 not supported"
-        );
-    }
-
     SECTION("hasFixedBinCount == false") {
         static auto outputs = TestPluginDescriptor::outputs;
         outputs[0].hasFixedBinCount = 0;
         descriptor.getOutputDescriptor = [](VampPluginHandle, unsigned int) {
             return const_cast<VampOutputDescriptor*>(outputs.data());
         };
+        auto plugin = PluginHostAdapter(descriptor, 48000);
+        REQUIRE(plugin.initialise(0, 0));
         REQUIRE_THROWS_WITH(
-            PluginHostAdapter(descriptor, 48000),
-            "Dynamic bin count of output \"output\" not supported"
+            plugin.process(Plugin::TimeDomainBuffer{}, 0),
+            "Dynamic bin count of output \"output\" requires processEvents"
         );
     }
 
@@ -51,9 +49,15 @@ TEST_CASE("PluginHostAdapter plugin requirements") {
         descriptor.getOutputDescriptor = [](VampPluginHandle, unsigned int) {
             return const_cast<VampOutputDescriptor*>(outputs.data());
         };
+        auto plugin = PluginHostAdapter(descriptor, 48000);
+        REQUIRE(plugin.initialise(0, 0));
         REQUIRE_THROWS_WITH(
-            PluginHostAdapter(descriptor, 48000),
-            "Sample type of output \"output\" not supported (OneSamplePerStep required)"
+            plugin.process(Plugin::TimeDomainBuffer{}, 0),
+            "Sample type of output \"output\" requires processEvents (OneSamplePerStep required)"
+        );
+        REQUIRE_THROWS_WITH(
+            plugin.processView(Plugin::TimeDomainBuffer{}, 0),
+            "Sample type of output \"output\" requires processEvents (OneSamplePerStep required)"
         );
     }
 }
@@ -149,6 +153,19 @@ TEST_CASE("PluginHostAdapter get/set parameter") {
     REQUIRE(plugin.getParameter("param2").value() == -1.0f);
     REQUIRE(plugin.setParameter("param2", -5.0f));
     REQUIRE(plugin.getParameter("param2").value() == -5.0f);
+
+    SECTION("Parameter handles") {
+        REQUIRE_FALSE(plugin.resolveParameter("invalid").has_value());
+        REQUIRE_FALSE(plugin.getParameter(Plugin::ParameterHandle{2}).has_value());
+        REQUIRE_FALSE(plugin.setParameter(Plugin::ParameterHandle{2}, 0.0f));
+
+        const auto handle = plugin.resolveParameter("param2");
+        REQUIRE(handle.has_value());
+        REQUIRE(handle->index == 1);
+        REQUIRE(plugin.setParameter(handle.value(), 3.0f));
+        REQUIRE(plugin.getParameter(handle.value()).value() == 3.0f);
+        REQUIRE(plugin.getParameter("param2").value() == 3.0f);
+    }
 }
 
 TEST_CASE("PluginHostAdapter get/set programs") {
@@ -222,7 +239,6 @@ TEST_CASE("PluginHostAdapter outputs") {
 
 TEST_CASE("PluginHostAdapter release output descriptors") {
     auto descriptor = TestPluginDescriptor::get();
-    auto plugin     = PluginHostAdapter(descriptor, 48000);
 
     static std::set<const VampOutputDescriptor*> released;
 
@@ -230,6 +246,7 @@ TEST_CASE("PluginHostAdapter release output descriptors") {
         released.insert(d);
     };
 
+    auto plugin = PluginHostAdapter(descriptor, 48000);  // output descriptors queried once
     plugin.getOutputDescriptors();
 
     for (const auto& d : TestPluginDescriptor::outputs) {
@@ -237,6 +254,90 @@ TEST_CASE("PluginHostAdapter release output descriptors") {
     }
 }
 
+TEST_CASE("PluginHostAdapter output descriptor cache") {
+    auto descriptor = TestPluginDescriptor::get();
+
+    static size_t queries = 0;
+    queries = 0;
+    descriptor.getOutputDescriptor = [](VampPluginHandle, unsigned int index) {
+        ++queries;
+        return const_cast<VampOutputDescriptor*>(&TestPluginDescriptor::outputs.at(index));
+    };
+
+    auto plugin = PluginHostAdapter(descriptor, 48000);
+    const auto outputCount = TestPluginDescriptor::outputs.size();
+    REQUIRE(queries == outputCount);
+
+    const auto outputs = plugin.getOutputDescriptors();
+    REQUIRE(outputs.size() == outputCount);
+    REQUIRE(plugin.getOutputDescriptors().data() == outputs.data());
+    REQUIRE(queries == outputCount);
+
+    SECTION("initialise") {
+        REQUIRE(plugin.initialise(512, 1024));
+        REQUIRE(queries == 2 * outputCount);
+        plugin.getOutputDescriptors();
+        REQUIRE(queries == 2 * outputCount);
+    }
+
+    SECTION("setParameter") {
+        REQUIRE(plugin.setParameter("param1", 2.0f));
+        REQUIRE(queries == 2 * outputCount);  // eager, getOutputDescriptors is read-only
+        plugin.getOutputDescriptors();
+        plugin.getOutputDescriptors();
+        REQUIRE(queries == 2 * outputCount);
+
+        REQUIRE(plugin.initialise(512, 1024));
+        REQUIRE(queries == 3 * outputCount);
+        REQUIRE(plugin.setParameter("param1", 2.0f));
+        REQUIRE(queries == 3 * outputCount);  // output layout is fixed after initialise
+    }
+
+    SECTION("selectProgram") {
+        REQUIRE(plugin.selectProgram("new"));
+        REQUIRE(queries == 2 * outputCount);  // eager, getOutputDescriptors is read-only
+        plugin.getOutputDescriptors();
+        plugin.getOutputDescriptors();
+        REQUIRE(queries == 2 * outputCount);
+
+        REQUIRE(plugin.initialise(512, 1024));
+        REQUIRE(queries == 3 * outputCount);
+        REQUIRE(plugin.selectProgram("new"));
+        REQUIRE(queries == 3 * outputCount);  // output layout is fixed after initialise
+    }
+
+    SECTION("reset") {
+        plugin.reset();
+        plugin.getOutputDescriptors();
+        REQUIRE(queries == outputCount);
+    }
+
+    SECTION("Parameter events") {
+        descriptor.process = [](VampPluginHandle, const float* const*, int, int) -> VampFeatureList* {
+            static std::array<VampFeatureUnion, 2> featureUnion{};
+            static std::array<float, 3>            values{};
+            featureUnion[0].v1.valueCount = static_cast<unsigned int>(values.size());
+            featureUnion[0].v1.values     = values.data();
+            static VampFeatureList featureList{
+                .featureCount = 1,
+                .features     = featureUnion.data(),
+            };
+            return &featureList;
+        };
+
+        // output layout is fixed after initialise
+        REQUIRE(plugin.initialise(0, 0));
+        const std::vector<Plugin::ParameterEvent> events{
+            {.offset = 0,   .parameter = Plugin::ParameterHandle{0}, .value = 1.0f},
+            {.offset = 100, .parameter = Plugin::ParameterHandle{0}, .value = 2.0f},
+        };
+        plugin.scheduleParameterEvents(events);
+        plugin.process(Plugin::TimeDomainBuffer{}, 0);
+        REQUIRE(plugin.getOutputDescriptors().data() == outputs.data());
+        REQUIRE(queries == 2 * outputCount);
+    }
+}
+
 TEST_CASE("PluginHostAdapter initialise") {
     auto descriptor = TestPluginDescriptor::get();
     auto plugin     = PluginHostAdapter(descriptor, 48000);
@@ -263,6 +364,93 @@ TEST_CASE("PluginHostAdapter initialise") {
     REQUIRE(blockSizeInit     == 1024);
 }
 
+TEST_CASE("PluginHostAdapter unspecified channel count") {
+    auto descriptor = TestPluginDescriptor::get();
+    REQUIRE(descriptor.getMinChannelCount(nullptr) == 0);
+    REQUIRE(descriptor.getMaxChannelCount(nullptr) == 0);
+
+    // reported as one channel for compatibility
+    auto plugin = PluginHostAdapter(descriptor, 48000);
+    CHECK(plugin.getMinChannelCount() == 1);
+    CHECK(plugin.getMaxChannelCount() == 1);
+    CHECK(plugin.initialise(512, 1024));
+    CHECK_THROWS_WITH(plugin.initialise(512, 1024, 2), "Invalid channel count: 2 (supported: 1 - 1)");
+}
+
+TEST_CASE("PluginHostAdapter multi-channel") {
+    auto descriptor = TestPluginDescriptor::get();
+    descriptor.getMinChannelCount = [](VampPluginHandle) { return 2u; };
+    descriptor.getMaxChannelCount = [](VampPluginHandle) { return 4u; };
+
+    static unsigned int inputChannelsInit = 0;
+    descriptor.initialise = [](VampPluginHandle, unsigned int inputChannels, unsigned int, unsigned int) {
+        inputChannelsInit = inputChannels;
+        return 1;
+    };
+
+    // feature values: first sample of each channel
+    static std::vector<float>              values(3);
+    static std::array<VampFeatureUnion, 2> featureUnion{};
+    featureUnion[0].v1.valueCount = static_cast<unsigned int>(values.size());
+    featureUnion[0].v1.values     = values.data();
+    static VampFeatureList featureList{
+        .featureCount = 1,
+        .features     = featureUnion.data(),
+    };
+
+    descriptor.process = [](
+        VampPluginHandle, const float* const* inputBuffers, int, int
+    ) -> VampFeatureList* {
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = i < inputChannelsInit ? inputBuffers[i][0] : 0.0f;
+        }
+        return &featureList;
+    };
+
+    auto plugin = PluginHostAdapter(descriptor, 48000);
+    CHECK(plugin.getMinChannelCount() == 2);
+    CHECK(plugin.getMaxChannelCount() == 4);
+
+    SECTION("Invalid channel count") {
+        REQUIRE_THROWS_WITH(plugin.initialise(2, 2), "Invalid channel count: 1 (supported: 2 - 4)");
+        REQUIRE_THROWS_WITH(plugin.initialise(2, 2, 5), "Invalid channel count: 5 (supported: 2 - 4)");
+    }
+
+    const std::vector<float> channel0{1.0f, 2.0f, 3.0f, 4.0f};
+    const std::vector<float> channel1{5.0f, 6.0f, 7.0f, 8.0f};
+    const std::array<Plugin::TimeDomainBuffer, 2> channels{channel0, channel1};
+
+    REQUIRE(plugin.initialise(2, 2, 2));
+    REQUIRE(inputChannelsInit == 2);
+
+    SECTION("Process") {
+        const std::array<Plugin::TimeDomainBuffer, 2> block{
+            std::span(channel0).first(2), std::span(channel1).first(2)
+        };
+        auto result = plugin.process(Plugin::TimeDomainChannels(block), 0);
+        REQUIRE(result.size() == 1);
+        REQUIRE_THAT(result[0], Equals(std::vector<float>{1.0f, 5.0f, 0.0f}));
+    }
+
+    SECTION("Process batch") {
+        const std::vector<uint64_t> timestamps(2);
+        std::vector<float>          features(6);
+        plugin.processBatch({Plugin::TimeDomainChannels(channels), 2, timestamps}, features);
+        REQUIRE_THAT(features, Equals(std::vector<float>{1.0f, 5.0f, 0.0f, 3.0f, 7.0f, 0.0f}));
+    }
+
+    SECTION("Wrong channel count") {
+        REQUIRE_THROWS_WITH(
+            plugin.process(Plugin::TimeDomainBuffer(channel0).first(2), 0),
+            "Wrong input buffer channel count: Channel count must match initialised channel count of 2"
+        );
+        REQUIRE_THROWS_WITH(
+            plugin.process(Plugin::TimeDomainChannels(channels).first(1), 0),
+            "Wrong input buffer channel count: Channel count must match initialised channel count of 2"
+        );
+    }
+}
+
 TEST_CASE("PluginHostAdapter reset") {
     auto descriptor = TestPluginDescriptor::get();
     auto plugin     = PluginHostAdapter(descriptor, 48000);
@@ -315,6 +503,346 @@ TEST_CASE("PluginHostAdapter process") {
     };
 }
 
+TEST_CASE("PluginHostAdapter empty feature list") {
+    auto descriptor = TestPluginDescriptor::get();
+
+    // returned by the pluginsdk adapter if the plugin throws
+    descriptor.process = [](VampPluginHandle, const float* const*, int, int) -> VampFeatureList* {
+        static std::array<VampFeatureList, 1> featureLists{};
+        return featureLists.data();
+    };
+    static size_t released = 0;
+    released = 0;
+    descriptor.releaseFeatureSet = [](VampFeatureList*) { ++released; };
+
+    auto plugin = PluginHostAdapter(descriptor, 48000);
+    REQUIRE(plugin.initialise(1, 1));
+    const std::vector<float> signal{1.0f};
+    const std::vector<uint64_t> timestamps{0};
+    std::vector<float> features(3);
+
+    const auto* message = "Feature count of output 0 must be 1, but is 0";
+    CHECK_THROWS_AS(plugin.process(Plugin::TimeDomainBuffer(signal), 0), std::runtime_error);
+    CHECK_THROWS_WITH(plugin.process(Plugin::TimeDomainBuffer(signal), 0), message);
+    CHECK(released == 2);
+
+    CHECK_THROWS_WITH(plugin.processView(Plugin::TimeDomainBuffer(signal), 0), message);
+    CHECK_THROWS_WITH(
+        plugin.processBatch({Plugin::TimeDomainBuffer(signal), 1, timestamps}, features), message
+    );
+    CHECK(released == 4);
+}
+
+TEST_CASE("PluginHostAdapter parameter events with Vamp C API") {
+    auto descriptor = TestPluginDescriptor::get();
+
+    // log of parameter changes (index, value) and process calls (-1)
+    static std::vector<std::pair<int, float>> calls;
+    calls.clear();
+
+    descriptor.setParameter = [](VampPluginHandle, int index, float value) {
+        calls.emplace_back(index, value);
+    };
+    descriptor.process = [](VampPluginHandle, const float* const*, int, int) -> VampFeatureList* {
+        calls.emplace_back(-1, 0.0f);
+        static std::array<VampFeatureUnion, 2> featureUnion{};
+        static std::array<float, 3>            values{};
+        featureUnion[0].v1.valueCount = static_cast<unsigned int>(values.size());
+        featureUnion[0].v1.values     = values.data();
+        static VampFeatureList featureList{
+            .featureCount = 1,
+            .features     = featureUnion.data(),
+        };
+        return &featureList;
+    };
+
+    auto plugin = PluginHostAdapter(descriptor, 48000);
+    REQUIRE(plugin.initialise(0, 0));
+
+    const Plugin::ParameterHandle param1{0};
+    const Plugin::ParameterHandle param2{1};
+
+    SECTION("Validation") {
+        const std::vector<Plugin::ParameterEvent> unsorted{
+            {.offset = 2, .parameter = param1, .value = 1.0f},
+            {.offset = 1, .parameter = param1, .value = 2.0f},
+        };
+        REQUIRE_THROWS_AS(plugin.scheduleParameterEvents(unsorted), std::invalid_argument);
+
+        const std::vector<Plugin::ParameterEvent> invalidHandle{
+            {.offset = 0, .parameter = Plugin::ParameterHandle{2}, .value = 1.0f},
+        };
+        REQUIRE_THROWS_AS(plugin.scheduleParameterEvents(invalidHandle), std::invalid_argument);
+    }
+
+    SECTION("Apply at block boundaries") {
+        const std::vector<Plugin::ParameterEvent> events{
+            {.offset = 0,   .parameter = param1, .value = 1.0f},
+            {.offset = 0,   .parameter = param2, .value = 2.0f},
+            {.offset = 100, .parameter = param1, .value = 3.0f},
+        };
+        plugin.scheduleParameterEvents(events);
+        plugin.process(Plugin::TimeDomainBuffer{}, 0);
+        plugin.process(Plugin::TimeDomainBuffer{}, 0);  // events consumed by first block
+
+        const std::vector<std::pair<int, float>> expected{
+            {0, 1.0f}, {1, 2.0f}, {-1, 0.0f}, {0, 3.0f}, {-1, 0.0f}
+        };
+        REQUIRE(calls == expected);
+    }
+
+    SECTION("Discard on reset") {
+        const std::vector<Plugin::ParameterEvent> events{
+            {.offset = 0, .parameter = param1, .value = 1.0f},
+        };
+        plugin.scheduleParameterEvents(events);
+        plugin.reset();
+        plugin.process(Plugin::TimeDomainBuffer{}, 0);
+
+        const std::vector<std::pair<int, float>> expected{{-1, 0.0f}};
+        REQUIRE(calls == expected);
+    }
+}
+
+TEST_CASE("PluginHostAdapter process view") {
+    auto descriptor = TestPluginDescriptor::get();
+    auto plugin     = std::make_unique<PluginHostAdapter>(descriptor, 48000);
+
+    static std::vector<float>              values{1.1f, 2.2f, 3.3f};
+    static std::array<VampFeatureUnion, 2> featureUnion{};
+    featureUnion[0].v1.valueCount = static_cast<unsigned int>(values.size());
+    featureUnion[0].v1.values     = values.data();
+    static VampFeatureList featureList{
+        .featureCount = 1,
+        .features     = featureUnion.data(),
+    };
+
+    static int released = 0;
+    released = 0;
+
+    descriptor.process = [](VampPluginHandle, const float* const*, int, int) -> VampFeatureList* {
+        return &featureList;
+    };
+    descriptor.releaseFeatureSet = [](VampFeatureList*) { ++released; };
+
+    REQUIRE(plugin->initialise(0, 0));
+    auto result = plugin->processView(Plugin::TimeDomainBuffer{}, 0);
+
+    REQUIRE(result.size() == 1);
+    CHECK(result[0].data() == values.data());  // no copy
+    CHECK(result[0].size() == values.size());
+    CHECK(released == 0);  // deferred
+
+    SECTION("Release with next process") {
+        plugin->processView(Plugin::TimeDomainBuffer{}, 0);
+        CHECK(released == 1);
+        plugin->process(Plugin::TimeDomainBuffer{}, 0);
+        CHECK(released == 3);
+    }
+
+    SECTION("Release with reset") {
+        plugin->reset();
+        CHECK(released == 1);
+        plugin->reset();
+        CHECK(released == 1);
+    }
+
+    SECTION("Release with processEvents") {
+        plugin->processEvents(Plugin::TimeDomainBuffer{}, 0);
+        CHECK(released == 2);  // pending and own feature set
+    }
+
+    SECTION("Release with initialise") {
+        plugin->initialise(0, 0);
+        CHECK(released == 1);
+    }
+
+    SECTION("Release with destruction") {
+        plugin.reset();
+        CHECK(released == 1);
+    }
+
+    SECTION("Empty feature list") {
+        featureList.featureCount = 0;
+        CHECK_THROWS_WITH(
+            plugin->processView(Plugin::TimeDomainBuffer{}, 0),
+            "Feature count of output 0 must be 1, but is 0"
+        );
+        featureList.featureCount = 1;
+    }
+}
+
+TEST_CASE("PluginHostAdapter process batch") {
+    auto descriptor = TestPluginDescriptor::get();
+    auto plugin     = PluginHostAdapter(descriptor, 48000);
+
+    // feature values: first sample of block, seconds and nanoseconds of timestamp
+    static std::vector<float>              values(3);
+    static std::array<VampFeatureUnion, 2> featureUnion{};
+    featureUnion[0].v1.valueCount = static_cast<unsigned int>(values.size());
+    featureUnion[0].v1.values     = values.data();
+    static VampFeatureList featureList{
+        .featureCount = 1,
+        .features     = featureUnion.data(),
+    };
+
+    static int released = 0;
+    released = 0;
+
+    descriptor.process = [](
+        VampPluginHandle, const float* const* inputBuffers, int sec, int nsec
+    ) -> VampFeatureList* {
+        values[0] = inputBuffers[0][0];
+        values[1] = static_cast<float>(sec);
+        values[2] = static_cast<float>(nsec);
+        return &featureList;
+    };
+    descriptor.releaseFeatureSet = [](VampFeatureList*) { ++released; };
+
+    const std::vector<float>    signal{0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+    const std::vector<uint64_t> timestamps{1'000'000'001, 2'000'000'002, 3'000'000'003};
+    std::vector<float>          features(timestamps.size() * 3);
+
+    REQUIRE(plugin.initialise(2, 4));
+
+    SECTION("Overlapping blocks") {
+        plugin.processBatch({Plugin::TimeDomainBuffer(signal), 2, timestamps}, features);
+        REQUIRE_THAT(features, Equals(std::vector<float>{0, 1, 1, 2, 2, 2, 4, 3, 3}));
+        REQUIRE(released == 3);
+    }
+
+    SECTION("Frame matrix") {
+        plugin.processBatch({Plugin::TimeDomainBuffer(signal), 4, std::span(timestamps).first(2)}, features);
+        REQUIRE_THAT(features, Equals(std::vector<float>{0, 1, 1, 4, 2, 2, 0, 0, 0}));
+        REQUIRE(released == 2);
+    }
+
+    SECTION("Input buffer too small") {
+        REQUIRE_THROWS_WITH(
+            plugin.processBatch({Plugin::TimeDomainBuffer(signal), 4, timestamps}, features),
+            "Input buffer too small: 3 blocks with hop size 4 require 12 elements"
+        );
+    }
+
+    SECTION("Feature matrix too small") {
+        REQUIRE_THROWS_WITH(
+            plugin.processBatch(
+                {Plugin::TimeDomainBuffer(signal), 2, timestamps}, std::span(features).first(8)
+            ),
+            "Feature matrix too small: 3 blocks require 9 elements"
+        );
+    }
+
+    SECTION("Wrong input domain") {
+        REQUIRE_THROWS_WITH(
+            plugin.processBatch({Plugin::FrequencyDomainBuffer{}, 2, timestamps}, features),
+            "Wrong input buffer type: Time domain required"
+        );
+    }
+
+    SECTION("Empty feature list") {
+        featureList.featureCount = 0;
+        REQUIRE_THROWS_WITH(
+            plugin.processBatch({Plugin::TimeDomainBuffer(signal), 2, timestamps}, features),
+            "Feature count of output 0 must be 1, but is 0"
+        );
+        REQUIRE(released == 1);
+        featureList.featureCount = 1;
+    }
+}
+
+TEST_CASE("PluginHostAdapter process events") {
+    auto descriptor = TestPluginDescriptor::get();
+
+    static auto outputs = TestPluginDescriptor::outputs;
+    outputs[0].hasFixedBinCount = 0;
+    outputs[0].sampleType       = GENERATE(vampFixedSampleRate, vampVariableSampleRate);
+    outputs[0].sampleRate       = 10.0f;
+    outputs[0].hasDuration      = 1;
+    descriptor.getOutputDescriptor = [](VampPluginHandle, unsigned int) {
+        return const_cast<VampOutputDescriptor*>(outputs.data());
+    };
+
+    // two features, first with timestamp and duration, second without
+    static std::vector<float>              values{1.0f, 2.0f, 3.0f};
+    static std::array<char, 6>             label{"onset"};
+    static std::array<VampFeatureUnion, 4> featureUnion{};
+    featureUnion[0].v1 = {
+        .hasTimestamp = 1, .sec = 1, .nsec = 5, .valueCount = 1, .values = values.data(), .label = label.data()
+    };
+    featureUnion[1].v1 = {
+        .hasTimestamp = 0, .sec = 0, .nsec = 0, .valueCount = 2, .values = values.data() + 1, .label = nullptr
+    };
+    featureUnion[2].v2 = {.hasDuration = 1, .durationSec = 0, .durationNsec = 7};
+    featureUnion[3].v2 = {.hasDuration = 0, .durationSec = 0, .durationNsec = 0};
+    static VampFeatureList featureList{
+        .featureCount = 2,
+        .features     = featureUnion.data(),
+    };
+    static VampFeatureList emptyFeatureList{
+        .featureCount = 0,
+        .features     = nullptr,
+    };
+
+    static int released = 0;
+    released = 0;
+
+    descriptor.process = [](VampPluginHandle, const float* const*, int, int) -> VampFeatureList* {
+        return &featureList;
+    };
+    descriptor.getRemainingFeatures = [](VampPluginHandle) -> VampFeatureList* {
+        return &emptyFeatureList;
+    };
+    descriptor.releaseFeatureSet = [](VampFeatureList*) { ++released; };
+
+    auto plugin = PluginHostAdapter(descriptor, 48000);
+
+    const auto descriptors = plugin.getOutputDescriptors();
+    REQUIRE(descriptors.size() == 1);
+    CHECK_FALSE(descriptors[0].hasFixedBinCount);
+    CHECK(descriptors[0].sampleRate == 10.0f);
+    CHECK(descriptors[0].hasDuration);
+
+    REQUIRE(plugin.initialise(0, 0));
+    const auto result = plugin.processEvents(Plugin::TimeDomainBuffer{}, 2'000'000'000);
+    CHECK(released == 1);
+
+    REQUIRE(result.size() == 1);
+    REQUIRE(result[0].size() == 2);
+
+    const auto& first  = result[0][0];
+    const auto& second = result[0][1];
+    CHECK(first.timestamp == 1'000'000'005);
+    CHECK(first.duration == 7);
+    CHECK_THAT(std::vector(first.values.begin(), first.values.end()), Equals(std::vector{1.0f}));
+    CHECK(first.label == "onset");
+    CHECK_FALSE(second.duration);
+    CHECK_THAT(std::vector(second.values.begin(), second.values.end()), Equals(std::vector{2.0f, 3.0f}));
+    CHECK(second.label.empty());
+
+    if (outputs[0].sampleType == vampFixedSampleRate) {
+        CHECK(descriptors[0].sampleType == Plugin::SampleType::FixedSampleRate);
+        CHECK(second.timestamp == 1'100'000'005);  // one period after previous feature
+    } else {
+        CHECK(descriptors[0].sampleType == Plugin::SampleType::VariableSampleRate);
+        CHECK(second.timestamp == 2'000'000'000);  // block timestamp
+    }
+
+    SECTION("Reuse storage") {
+        const auto* valuesData = first.values.data();
+        const auto  next       = plugin.processEvents(Plugin::TimeDomainBuffer{}, 0);
+        REQUIRE(next[0].size() == 2);
+        CHECK(next[0][0].values.data() == valuesData);
+    }
+
+    SECTION("Remaining features") {
+        const auto remaining = plugin.getRemainingFeatures();
+        CHECK(released == 2);
+        REQUIRE(remaining.size() == 1);
+        CHECK(remaining[0].empty());
+    }
+}
+
 TEST_CASE("PluginHostAdapter process with wrong input domain") {
     auto descriptor = TestPluginDescriptor::get();
     auto plugin     = PluginHostAdapter(descriptor, 48000);
@@ -1,15 +1,28 @@
+#include <complex>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_all.hpp>
 
+#include "vamp/vamp.h"
+
+#include "rtvamp/hostsdk/PluginHostAdapter.hpp"
 #include "rtvamp/hostsdk/PluginLibrary.hpp"
 
+#include "DynamicLibrary.hpp"
+#include "PluginLibraryAccess.hpp"
+
 #include "helper.hpp"
 
 using Catch::Matchers::Equals;
 using Catch::Matchers::StartsWith;
+using rtvamp::hostsdk::DynamicLibrary;
 using rtvamp::hostsdk::Plugin;
+using rtvamp::hostsdk::PluginHostAdapter;
 using rtvamp::hostsdk::PluginKey;
 using rtvamp::hostsdk::PluginLibrary;
+using rtvamp::hostsdk::PluginLibraryAccess;
 
 TEST_CASE("PluginLibrary") {
     SECTION("Non-existing library") {
@@ -75,6 +88,71 @@ TEST_CASE("PluginLibrary") {
         }
     }
 
+    SECTION("Construct from loaded library") {
+        REQUIRE_THROWS_WITH(
+            PluginLibraryAccess::create(std::shared_ptr<DynamicLibrary>{}),
+            "Dynamic library not loaded"
+        );
+
+        const auto path = getLibraryPath("example-plugin");
+        const auto library = PluginLibraryAccess::create(std::make_shared<DynamicLibrary>(path));
+        CHECK(library.getLibraryPath() == path);
+        CHECK(library.getPluginCount() >= 2);
+    }
+
+    SECTION("Process with rt-vamp extension") {
+        const auto dl = std::make_shared<DynamicLibrary>(getLibraryPath("example-plugin"));
+        const auto getDescriptor = dl->getFunction<VampGetPluginDescriptorFunction>("vampGetPluginDescriptor");
+        REQUIRE(getDescriptor != nullptr);
+        const auto* descriptor = getDescriptor(VAMP_API_VERSION, 0);
+        REQUIRE(descriptor != nullptr);
+
+        PluginHostAdapter pluginExtension(*descriptor, 48000, dl);
+        PluginHostAdapter pluginVamp(*descriptor, 48000);  // without library -> no extension
+        CHECK(pluginExtension.hasExtension());
+        CHECK_FALSE(pluginVamp.hasExtension());
+        CHECK(pluginExtension.isStateless());  // declared in meta of the RMS plugin
+        CHECK_FALSE(pluginVamp.isStateless());  // unknown without extension
+        CHECK(pluginVamp.getWarmUpLength() == 0);
+
+        const std::vector<float> signal{1.0F, -2.0F, 3.0F, -4.0F};
+        REQUIRE(pluginExtension.initialise(4, 4));
+        REQUIRE(pluginVamp.initialise(4, 4));
+
+        const auto expected = pluginVamp.process(signal, 0);
+        REQUIRE(expected.size() == 1);
+        CHECK_THAT(pluginExtension.process(signal, 0)[0], Equals(expected[0]));
+
+        const auto view = pluginExtension.processView(signal, 0);
+        REQUIRE(view.size() == 1);
+        CHECK_THAT(std::vector(view[0].begin(), view[0].end()), Equals(expected[0]));
+    }
+
+    SECTION("Parameter events with rt-vamp extension") {
+        const auto dl = std::make_shared<DynamicLibrary>(getLibraryPath("example-plugin"));
+        const auto getDescriptor = dl->getFunction<VampGetPluginDescriptorFunction>("vampGetPluginDescriptor");
+        REQUIRE(getDescriptor != nullptr);
+        const auto* descriptor = getDescriptor(VAMP_API_VERSION, 1);  // spectral roll-off
+        REQUIRE(descriptor != nullptr);
+
+        const bool useExtension = GENERATE(true, false);
+        PluginHostAdapter plugin(*descriptor, 48000, useExtension ? dl : nullptr);
+        REQUIRE(plugin.hasExtension() == useExtension);
+        REQUIRE(plugin.initialise(4, 4));
+
+        const auto handle = plugin.resolveParameter("rolloff");
+        REQUIRE(handle.has_value());
+        const std::vector<Plugin::ParameterEvent> events{
+            {.offset = 0, .parameter = handle.value(), .value = 0.5F},
+            {.offset = 2, .parameter = handle.value(), .value = 0.25F},
+        };
+        plugin.scheduleParameterEvents(events);
+
+        const std::vector<std::complex<float>> spectrum(3, 1.0F);
+        plugin.process(spectrum, 0);
+        CHECK(plugin.getParameter(handle.value()).value() == 0.25F);
+    }
+
     SECTION("Load plugin & check lifetime of library handle") {
         std::unique_ptr<Plugin> plugin;
 
@@ -0,0 +1,58 @@
+#include <filesystem>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "rtvamp/hostsdk.hpp"
+
+#include "config.hpp"
+#include "helper.hpp"
+
+using rtvamp::hostsdk::PluginKey;
+using rtvamp::hostsdk::PluginRegistry;
+
+TEST_CASE("PluginRegistry") {
+    const std::vector<std::filesystem::path> paths{searchPath};
+
+    SECTION("Invalid path") {
+        const PluginRegistry registry(std::vector<std::filesystem::path>{"thisshouldbeaninvalidpath"});
+        CHECK(registry.getLibraryCount() == 0);
+        CHECK(registry.getPluginCount() == 0);
+        CHECK(registry.listPlugins().empty());
+    }
+
+    const PluginRegistry registry(paths);
+
+    SECTION("Match discovery") {
+        CHECK(registry.listPlugins() == rtvamp::hostsdk::listPlugins(paths));
+        CHECK(registry.getPluginCount() == registry.listPlugins().size());
+    }
+
+    SECTION("Find library") {
+        const auto* library = registry.findLibrary("example-plugin");
+        REQUIRE(library != nullptr);
+        CHECK(library->getLibraryPath() == getLibraryPath("example-plugin"));
+        CHECK(registry.findLibrary("invalid-plugin") == nullptr);
+        CHECK(registry.findLibrary("unknown") == nullptr);
+    }
+
+    SECTION("Load plugin") {
+        CHECK(registry.contains(PluginKey("example-plugin:rms")));
+        const auto plugin = registry.loadPlugin("example-plugin:rms", 48000);
+        REQUIRE(plugin);
+        CHECK(plugin->getIdentifier() == "rms");
+        CHECK(plugin->getLibraryPath() == getLibraryPath("example-plugin"));
+
+        const auto rolloff = registry.loadPlugin("example-plugin:spectralrolloff", 48000);
+        REQUIRE(rolloff);
+        CHECK(rolloff->getIdentifier() == "spectralrolloff");
+    }
+
+    SECTION("Unknown plugin") {
+        CHECK_FALSE(registry.contains(PluginKey("example-plugin:unknown")));
+        REQUIRE_THROWS_WITH(
+            registry.loadPlugin("example-plugin:unknown", 48000),
+            "Plugin not found: example-plugin:unknown"
+        );
+    }
+}
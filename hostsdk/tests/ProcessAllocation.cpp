@@ -0,0 +1,116 @@
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "vamp/vamp.h"
+
+#include "rtvamp/hostsdk/PluginHostAdapter.hpp"
+
+#include "AllocationCounter.hpp"
+#include "DynamicLibrary.hpp"
+
+#include "helper.hpp"
+
+using rtvamp::hostsdk::DynamicLibrary;
+using rtvamp::hostsdk::Plugin;
+using rtvamp::hostsdk::PluginHostAdapter;
+
+/**
+ * Positive control: an allocation in the scope of the counter must be counted, otherwise the
+ * replaced allocation functions are not active and the test would pass without measuring.
+ */
+static void requireCounting(const AllocationCounter& counter) {
+    const size_t before = counter.count();
+    ::operator delete(::operator new(sizeof(int)));  // function call, can not be elided
+    REQUIRE(counter.count() > before);
+}
+
+TEST_CASE("Allocation-free processing after initialise") {
+    // plugins of the examples: RMS, SpectralRolloff and ZeroCrossing (minimal example)
+    const auto [libraryName, pluginIndex] = GENERATE(
+        std::tuple<std::string_view, int>{"example-plugin", 0},
+        std::tuple<std::string_view, int>{"example-plugin", 1},
+        std::tuple<std::string_view, int>{"minimal-plugin", 0}
+    );
+    const bool useExtension = GENERATE(true, false);  // hostsdk -> pluginsdk via extension or Vamp C API
+
+    const auto dl            = std::make_shared<DynamicLibrary>(getLibraryPath(libraryName));
+    const auto getDescriptor = dl->getFunction<VampGetPluginDescriptorFunction>("vampGetPluginDescriptor");
+    REQUIRE(getDescriptor != nullptr);
+    const auto* descriptor = getDescriptor(VAMP_API_VERSION, pluginIndex);
+    REQUIRE(descriptor != nullptr);
+
+    PluginHostAdapter plugin(*descriptor, 48000, useExtension ? dl : nullptr);
+    CAPTURE(plugin.getIdentifier(), useExtension);
+    REQUIRE(plugin.hasExtension() == useExtension);
+
+    constexpr uint32_t blockSize  = 256;
+    constexpr uint32_t binCount   = blockSize / 2 + 1;
+    constexpr size_t   blockCount = 4;
+    REQUIRE(plugin.initialise(blockSize, blockSize));
+
+    std::vector<float>               signal(blockCount * blockSize);
+    std::vector<std::complex<float>> spectrum(blockCount * binCount);
+    for (size_t i = 0; i < signal.size(); ++i) {
+        signal[i] = (i % 3 == 0) ? -1.0F : 1.0F;
+    }
+    for (size_t i = 0; i < spectrum.size(); ++i) {
+        spectrum[i] = {static_cast<float>(i % binCount), 1.0F};
+    }
+
+    const bool isTimeDomain = plugin.getInputDomain() == Plugin::InputDomain::Time;
+    const Plugin::InputBuffer buffer = isTimeDomain
+        ? Plugin::InputBuffer(Plugin::TimeDomainBuffer(signal).first(blockSize))
+        : Plugin::InputBuffer(Plugin::FrequencyDomainBuffer(spectrum).first(binCount));
+    const Plugin::InputBuffer bufferBatch = isTimeDomain
+        ? Plugin::InputBuffer(Plugin::TimeDomainBuffer(signal))
+        : Plugin::InputBuffer(Plugin::FrequencyDomainBuffer(spectrum));
+
+    const std::vector<uint64_t> timestamps{0, 1, 2, 3};
+    std::vector<float>          features(blockCount * plugin.getOutputCount());
+
+    size_t allocations = 0;
+
+    SECTION("process") {
+        const AllocationCounter counter;
+        for (uint64_t i = 0; i < blockCount; ++i) {
+            plugin.process(buffer, i);
+        }
+        allocations = counter.count();
+        requireCounting(counter);
+    }
+
+    SECTION("processView") {
+        const AllocationCounter counter;
+        for (uint64_t i = 0; i < blockCount; ++i) {
+            plugin.processView(buffer, i);
+        }
+        allocations = counter.count();
+        requireCounting(counter);
+    }
+
+    SECTION("processBatch") {
+        const Plugin::InputBlocks blocks{bufferBatch, isTimeDomain ? blockSize : binCount, timestamps};
+        const AllocationCounter counter;
+        plugin.processBatch(blocks, features);
+        allocations = counter.count();
+        requireCounting(counter);
+    }
+
+    SECTION("processEvents") {
+        const AllocationCounter counter;
+        for (uint64_t i = 0; i < blockCount; ++i) {
+            plugin.processEvents(buffer, i);
+        }
+        allocations = counter.count();
+        requireCounting(counter);
+    }
+
+    CHECK(allocations == 0);
+}
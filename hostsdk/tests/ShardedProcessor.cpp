@@ -0,0 +1,145 @@
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "rtvamp/hostsdk/PluginLibrary.hpp"
+#include "rtvamp/hostsdk/ShardedProcessor.hpp"
+#include "rtvamp/hostsdk/SpectralFrontEnd.hpp"
+
+#include "helper.hpp"
+
+using rtvamp::hostsdk::Plugin;
+using rtvamp::hostsdk::PluginLibrary;
+using rtvamp::hostsdk::ShardedProcessor;
+using rtvamp::hostsdk::SpectralFrontEnd;
+
+static std::vector<float> createSignal(size_t size) {
+    std::vector<float> signal(size);
+    uint32_t state = 1;
+    for (auto& sample : signal) {
+        state  = state * 1664525U + 1013904223U;  // LCG
+        sample = static_cast<float>(state >> 8) / static_cast<float>(1U << 24) - 0.5F;
+    }
+    return signal;
+}
+
+// process all blocks serially with a single instance
+static std::vector<float> processSerial(
+    Plugin& plugin, const std::vector<float>& signal, uint32_t stepSize, uint32_t blockSize
+) {
+    REQUIRE(plugin.initialise(stepSize, blockSize));
+    SpectralFrontEnd   frontEnd(blockSize);
+    std::vector<float> features;
+    for (size_t offset = 0; offset + blockSize <= signal.size(); offset += stepSize) {
+        const auto block = Plugin::TimeDomainBuffer(signal).subspan(offset, blockSize);
+        const auto input = plugin.getInputDomain() == Plugin::InputDomain::Time
+            ? Plugin::InputBuffer(block)
+            : frontEnd.compute(block);
+        features.push_back(plugin.process(input, 0)[0][0]);
+    }
+    return features;
+}
+
+TEST_CASE("ShardedProcessor") {
+    constexpr uint32_t stepSize  = 128;
+    constexpr uint32_t blockSize = 256;
+    const auto         signal    = createSignal(100 * stepSize + 37);
+
+    PluginLibrary exampleLibrary(getLibraryPath("example-plugin"));
+    PluginLibrary minimalLibrary(getLibraryPath("minimal-plugin"));
+
+    const ShardedProcessor::Options options{
+        .stepSize  = stepSize,
+        .blockSize = blockSize,
+        .threads   = GENERATE(1U, 3U, 8U),
+    };
+    CAPTURE(options.threads);
+
+    const auto checkResult = [&](const ShardedProcessor::Result& result, const std::vector<float>& expected) {
+        REQUIRE(result.rowSize == 1);
+        REQUIRE(result.timestamps.size() == expected.size());
+        REQUIRE(result.features.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            CAPTURE(i);
+            CHECK(result.timestamps[i] == i * stepSize * 1'000'000'000ULL / 48000);
+            CHECK(result.features[i] == expected[i]);
+        }
+    };
+
+    SECTION("Stateless time domain plugin") {
+        ShardedProcessor processor(exampleLibrary, "example-plugin:rms", 48000, options);
+        CHECK(processor.isShardable());
+        CHECK(processor.getWarmUpBlocks() == 0);
+        CHECK(processor.getPluginCount() == options.threads);
+
+        auto reference = exampleLibrary.loadPlugin("example-plugin:rms", 48000);
+        checkResult(processor.process(Plugin::TimeDomainBuffer(signal)), processSerial(*reference, signal, stepSize, blockSize));
+    }
+
+    SECTION("Stateless frequency domain plugin with parameter") {
+        ShardedProcessor processor(exampleLibrary, "example-plugin:spectralrolloff", 48000, options);
+        CHECK(processor.isShardable());
+        CHECK(processor.setParameter("rolloff", 0.5F));
+        CHECK_FALSE(processor.setParameter("unknown", 0.5F));
+
+        auto reference = exampleLibrary.loadPlugin("example-plugin:spectralrolloff", 48000);
+        REQUIRE(reference->setParameter("rolloff", 0.5F));
+        checkResult(processor.process(Plugin::TimeDomainBuffer(signal)), processSerial(*reference, signal, stepSize, blockSize));
+    }
+
+    SECTION("Stateful plugin with warm-up") {
+        ShardedProcessor processor(minimalLibrary, "minimal-plugin:zerocrossing", 48000, options);
+        CHECK(processor.isShardable());
+        CHECK(processor.getWarmUpBlocks() == 1);
+
+        auto reference = minimalLibrary.loadPlugin("minimal-plugin:zerocrossing", 48000);
+        const auto expected = processSerial(*reference, signal, stepSize, blockSize);
+        checkResult(processor.process(Plugin::TimeDomainBuffer(signal)), expected);
+        checkResult(processor.process(Plugin::TimeDomainBuffer(signal)), expected);  // instances are reset
+    }
+
+    SECTION("Stateful plugin with unknown warm-up length") {
+        auto unknownOptions         = options;
+        unknownOptions.warmUpLength = 0;
+        ShardedProcessor processor(minimalLibrary, "minimal-plugin:zerocrossing", 48000, unknownOptions);
+        CHECK_FALSE(processor.isShardable());
+        CHECK(processor.getPluginCount() == 1);
+
+        auto reference = minimalLibrary.loadPlugin("minimal-plugin:zerocrossing", 48000);
+        checkResult(processor.process(Plugin::TimeDomainBuffer(signal)), processSerial(*reference, signal, stepSize, blockSize));
+    }
+
+    SECTION("Signal shorter than a block") {
+        ShardedProcessor processor(exampleLibrary, "example-plugin:rms", 48000, options);
+        const auto result = processor.process(Plugin::TimeDomainBuffer(signal).first(blockSize - 1));
+        CHECK(result.rowSize == 1);
+        CHECK(result.timestamps.empty());
+        CHECK(result.features.empty());
+    }
+}
+
+TEST_CASE("ShardedProcessor invalid arguments") {
+    PluginLibrary library(getLibraryPath("example-plugin"));
+
+    CHECK_THROWS_AS(
+        ShardedProcessor(library, "example-plugin:rms", 48000, {.stepSize = 0, .blockSize = 256}),
+        std::invalid_argument
+    );
+    CHECK_THROWS_AS(
+        ShardedProcessor(library, "example-plugin:rms", 48000, {.stepSize = 256, .blockSize = 256, .channelCount = 0}),
+        std::invalid_argument
+    );
+
+    ShardedProcessor processor(library, "example-plugin:rms", 48000, {.stepSize = 4, .blockSize = 4, .threads = 2});
+
+    const std::vector<float>                 signal(16);
+    const std::vector<std::complex<float>>   spectrum(3);
+    const std::array<Plugin::TimeDomainBuffer, 2> channels{signal, signal};
+    CHECK_THROWS_AS(processor.process(Plugin::FrequencyDomainBuffer(spectrum)), std::invalid_argument);
+    CHECK_THROWS_AS(processor.process(Plugin::TimeDomainChannels(channels)), std::invalid_argument);
+}
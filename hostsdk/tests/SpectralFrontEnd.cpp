@@ -0,0 +1,115 @@
+#include <array>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "rtvamp/hostsdk/PluginLibrary.hpp"
+#include "rtvamp/hostsdk/SpectralFrontEnd.hpp"
+#include "rtvamp/hostsdk/StreamProcessor.hpp"
+
+#include "helper.hpp"
+
+using Catch::Approx;
+using rtvamp::hostsdk::Plugin;
+using rtvamp::hostsdk::PluginLibrary;
+using rtvamp::hostsdk::SpectralFrontEnd;
+using rtvamp::hostsdk::StreamProcessor;
+using rtvamp::hostsdk::WindowType;
+
+TEST_CASE("SpectralFrontEnd window") {
+    const auto window = rtvamp::hostsdk::getWindow(WindowType::Hann, 512);
+    const SpectralFrontEnd frontEnd(512);
+    CHECK(frontEnd.getWindow().data() == window->data());
+}
+
+TEST_CASE("SpectralFrontEnd") {
+    constexpr uint32_t blockSize = 8;
+
+    SECTION("Invalid arguments") {
+        CHECK_THROWS_AS(SpectralFrontEnd(0), std::invalid_argument);
+        CHECK_THROWS_AS(SpectralFrontEnd(blockSize, 0), std::invalid_argument);
+
+        SpectralFrontEnd frontEnd(blockSize);
+        const std::vector<float>               signal(blockSize + 1);
+        const std::vector<std::complex<float>> spectrum(blockSize / 2 + 1);
+        CHECK_THROWS_AS(frontEnd.compute(Plugin::TimeDomainBuffer(signal)), std::invalid_argument);
+        CHECK_THROWS_AS(frontEnd.compute(Plugin::FrequencyDomainBuffer(spectrum)), std::invalid_argument);
+    }
+
+    SECTION("Windowed spectrum of each channel") {
+        const std::vector<float> left{1, 2, 3, 4, 5, 6, 7, 8};
+        const std::vector<float> right{0, 1, 0, -1, 0, 1, 0, -1};
+        const std::array<Plugin::TimeDomainBuffer, 2> channels{left, right};
+
+        SpectralFrontEnd frontEnd(blockSize, 2, WindowType::Hamming);
+        REQUIRE(frontEnd.getBinCount() == blockSize / 2 + 1);
+        REQUIRE(frontEnd.getWindowType() == WindowType::Hamming);
+
+        const auto output = frontEnd.compute(Plugin::TimeDomainChannels(channels));
+        REQUIRE(std::holds_alternative<Plugin::FrequencyDomainChannels>(output));
+        const auto spectra = std::get<Plugin::FrequencyDomainChannels>(output);
+        REQUIRE(spectra.size() == 2);
+
+        const auto window = frontEnd.getWindow();
+        rtvamp::hostsdk::FFT fft(blockSize);
+        for (size_t channel = 0; channel < 2; ++channel) {
+            std::vector<float> windowed(blockSize);
+            for (size_t i = 0; i < blockSize; ++i) {
+                windowed[i] = channels[channel][i] * window[i];
+            }
+            const auto expected = fft.compute(windowed);
+            REQUIRE(spectra[channel].size() == expected.size());
+            for (size_t k = 0; k < expected.size(); ++k) {
+                CHECK(spectra[channel][k] == expected[k]);
+            }
+        }
+    }
+}
+
+TEST_CASE("StreamProcessor with frequency domain plugins") {
+    constexpr uint32_t blockSize = 256;
+    constexpr uint32_t stepSize  = 128;
+
+    PluginLibrary library(getLibraryPath("example-plugin"));
+    auto rms             = library.loadPlugin("example-plugin:rms", 48000);
+    auto spectralRolloff = library.loadPlugin("example-plugin:spectralrolloff", 48000);
+    auto reference       = library.loadPlugin("example-plugin:spectralrolloff", 48000);
+    REQUIRE(spectralRolloff->getInputDomain() == Plugin::InputDomain::Frequency);
+    REQUIRE(reference->initialise(stepSize, blockSize));
+
+    std::vector<float> signal(4 * blockSize);
+    for (size_t i = 0; i < signal.size(); ++i) {
+        signal[i] = std::sin(0.05F * static_cast<float>(i)) + 0.5F * std::sin(1.3F * static_cast<float>(i));
+    }
+
+    // reference: window and FFT each block in the test
+    SpectralFrontEnd frontEnd(blockSize);
+    std::vector<float> expected;
+    for (size_t offset = 0; offset + blockSize <= signal.size(); offset += stepSize) {
+        const auto spectrum = frontEnd.compute(Plugin::TimeDomainBuffer(signal).subspan(offset, blockSize));
+        expected.push_back(reference->process(spectrum, 0)[0][0]);
+    }
+
+    const std::array<Plugin*, 2> plugins{rms.get(), spectralRolloff.get()};
+    std::vector<float> rmsValues;
+    std::vector<float> rolloffValues;
+    StreamProcessor stream(
+        plugins, stepSize, blockSize, 1, [&](size_t pluginIndex, uint64_t, Plugin::FeatureSet features) {
+            (pluginIndex == 0 ? rmsValues : rolloffValues).push_back(features[0][0]);
+        }
+    );
+    stream.pushInterleaved(signal);
+
+    REQUIRE(rolloffValues.size() == expected.size());
+    REQUIRE(rmsValues.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        CHECK(rolloffValues[i] == Approx(expected[i]));
+        CHECK(rmsValues[i] > 0.0F);
+    }
+}
@@ -0,0 +1,207 @@
+#include <array>
+#include <cstdint>
+#include <numeric>  // iota
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "vamp/vamp.h"
+
+#include "rtvamp/hostsdk/PluginHostAdapter.hpp"
+#include "rtvamp/hostsdk/StreamProcessor.hpp"
+
+#include "TestPluginDescriptor.hpp"
+
+using rtvamp::hostsdk::Plugin;
+using rtvamp::hostsdk::PluginHostAdapter;
+using rtvamp::hostsdk::StreamProcessor;
+
+namespace {
+
+/** First and last sample of each channel of a processed block. */
+struct Block {
+    std::vector<float> first;
+    std::vector<float> last;
+};
+
+std::vector<Block> processedBlocks;
+uint32_t           processedBlockSize    = 0;
+uint32_t           processedChannelCount = 1;
+
+VampPluginDescriptor getRecordingDescriptor(uint32_t maxChannelCount) {
+    auto descriptor = TestPluginDescriptor::get();
+    processedBlocks.clear();
+    descriptor.getMaxChannelCount = maxChannelCount == 1
+        ? [](VampPluginHandle) { return 1u; }
+        : [](VampPluginHandle) { return 2u; };
+    descriptor.initialise = [](VampPluginHandle, unsigned int channels, unsigned int, unsigned int blockSize) {
+        processedBlockSize    = blockSize;
+        processedChannelCount = channels;
+        return 1;
+    };
+    descriptor.process = [](
+        VampPluginHandle, const float* const* inputBuffers, int, int
+    ) -> VampFeatureList* {
+        Block block;
+        for (uint32_t i = 0; i < processedChannelCount; ++i) {
+            block.first.push_back(inputBuffers[i][0]);
+            block.last.push_back(inputBuffers[i][processedBlockSize - 1]);
+        }
+        processedBlocks.push_back(block);
+
+        static std::array<float, 3>            values{};
+        static std::array<VampFeatureUnion, 2> featureUnion{};
+        featureUnion[0].v1.valueCount = static_cast<unsigned int>(values.size());
+        featureUnion[0].v1.values     = values.data();
+        static VampFeatureList featureList{
+            .featureCount = 1,
+            .features     = featureUnion.data(),
+        };
+        return &featureList;
+    };
+    return descriptor;
+}
+
+}  // namespace
+
+TEST_CASE("StreamProcessor") {
+    const auto descriptor = getRecordingDescriptor(1);
+    PluginHostAdapter plugin(descriptor, 48000);
+    const std::array<Plugin*, 1> plugins{&plugin};
+
+    std::vector<uint64_t> timestamps;
+    const auto callback = [&](size_t pluginIndex, uint64_t nsec, Plugin::FeatureSet features) {
+        CHECK(pluginIndex == 0);
+        CHECK(features.size() == 1);
+        timestamps.push_back(nsec);
+    };
+
+    SECTION("Invalid arguments") {
+        CHECK_THROWS_AS(StreamProcessor(plugins, 0, 4, 1, callback), std::invalid_argument);
+        CHECK_THROWS_AS(StreamProcessor(plugins, 4, 0, 1, callback), std::invalid_argument);
+        CHECK_THROWS_AS(StreamProcessor(plugins, 4, 4, 2, callback), std::invalid_argument);
+        CHECK_THROWS_AS(StreamProcessor({}, 4, 4, 1, callback), std::invalid_argument);
+    }
+
+    SECTION("Overlapping blocks from pushes of any size") {
+        constexpr uint32_t stepSize  = 3;
+        constexpr uint32_t blockSize = 8;
+        StreamProcessor stream(plugins, stepSize, blockSize, 1, callback);
+        REQUIRE(stream.getCapacity() == 2 * blockSize);
+
+        std::vector<float> signal(100);
+        std::iota(signal.begin(), signal.end(), 0.0f);
+
+        const size_t pushSize = GENERATE(1, 5, 16, 100);
+        for (size_t offset = 0; offset < signal.size(); offset += pushSize) {
+            const size_t size = std::min(pushSize, signal.size() - offset);
+            stream.pushInterleaved(std::span(signal).subspan(offset, size));
+        }
+
+        const size_t blockCount = (signal.size() - blockSize) / stepSize + 1;
+        REQUIRE(processedBlocks.size() == blockCount);
+        REQUIRE(timestamps.size() == blockCount);
+        for (size_t i = 0; i < blockCount; ++i) {
+            CHECK(processedBlocks[i].first[0] == static_cast<float>(i * stepSize));
+            CHECK(processedBlocks[i].last[0] == static_cast<float>(i * stepSize + blockSize - 1));
+            CHECK(timestamps[i] == i * stepSize * 1'000'000'000 / 48000);
+        }
+    }
+
+    SECTION("Write and process separately") {
+        StreamProcessor stream(plugins, 4, 4, 1, callback);
+        const std::vector<float> signal(20, 1.0f);
+
+        CHECK(stream.getWritableSamples() == 8);
+        CHECK(stream.writeInterleaved(signal) == 8);  // limited by capacity
+        CHECK(stream.getWritableSamples() == 0);
+        CHECK(stream.writeInterleaved(signal) == 0);
+        CHECK(stream.process() == 2);
+        CHECK(stream.getWritableSamples() == 8);
+        CHECK(stream.process() == 0);
+    }
+
+    SECTION("Reset") {
+        StreamProcessor stream(plugins, 4, 4, 1, callback);
+        const std::vector<float> signal(6, 1.0f);
+        stream.pushInterleaved(signal);
+        stream.reset();
+        stream.pushInterleaved(signal);
+        REQUIRE(timestamps.size() == 2);
+        CHECK(timestamps[0] == 0);
+        CHECK(timestamps[1] == 0);
+    }
+
+    SECTION("Exact timestamps") {
+        StreamProcessor stream(plugins, 4, 4, 1, callback);
+        CHECK(stream.getTimestamp(0) == 0);
+        CHECK(stream.getTimestamp(1) == 20'833);
+        CHECK(stream.getTimestamp(48000) == 1'000'000'000);
+        CHECK(stream.getTimestamp(48000ULL * 3600 * 24 * 365) == 1'000'000'000ULL * 3600 * 24 * 365);
+        CHECK(stream.getTimestamp(48000ULL * 3600 * 24 * 365 + 24000) == 1'000'000'000ULL * 3600 * 24 * 365 + 500'000'000);
+    }
+}
+
+TEST_CASE("StreamProcessor multi-channel") {
+    const auto descriptor = getRecordingDescriptor(2);
+    PluginHostAdapter plugin(descriptor, 48000);
+    const std::array<Plugin*, 1> plugins{&plugin};
+
+    StreamProcessor stream(plugins, 2, 4, 2, nullptr);
+
+    SECTION("Interleaved") {
+        const std::vector<float> interleaved{0, 10, 1, 11, 2, 12, 3, 13, 4, 14, 5, 15};
+        CHECK_THROWS_AS(stream.writeInterleaved(std::span(interleaved).first(3)), std::invalid_argument);
+        stream.pushInterleaved(interleaved);
+    }
+
+    SECTION("Planar") {
+        const std::vector<float> left{0, 1, 2, 3, 4, 5};
+        const std::vector<float> right{10, 11, 12, 13, 14, 15};
+        const std::array<std::span<const float>, 2> channels{left, right};
+        CHECK_THROWS_AS(stream.writePlanar(std::span(channels).first(1)), std::invalid_argument);
+        stream.pushPlanar(channels);
+    }
+
+    REQUIRE(processedBlocks.size() == 2);
+    CHECK(processedBlocks[0].first == std::vector<float>{0, 10});
+    CHECK(processedBlocks[0].last  == std::vector<float>{3, 13});
+    CHECK(processedBlocks[1].first == std::vector<float>{2, 12});
+    CHECK(processedBlocks[1].last  == std::vector<float>{5, 15});
+}
+
+TEST_CASE("StreamProcessor producer/consumer threads") {
+    const auto descriptor = getRecordingDescriptor(1);
+    PluginHostAdapter plugin(descriptor, 48000);
+    const std::array<Plugin*, 1> plugins{&plugin};
+
+    constexpr uint32_t stepSize  = 16;
+    constexpr uint32_t blockSize = 64;
+    StreamProcessor stream(plugins, stepSize, blockSize, 1, nullptr, 256);
+
+    std::vector<float> signal(10'000);
+    std::iota(signal.begin(), signal.end(), 0.0f);
+
+    std::thread producer([&] {
+        size_t offset = 0;
+        while (offset < signal.size()) {
+            offset += stream.writeInterleaved(std::span(signal).subspan(offset, std::min<size_t>(100, signal.size() - offset)));
+        }
+    });
+
+    const size_t blockCount = (signal.size() - blockSize) / stepSize + 1;
+    size_t       processed  = 0;
+    while (processed < blockCount) {
+        processed += stream.process();
+    }
+    producer.join();
+
+    REQUIRE(processedBlocks.size() == blockCount);
+    for (size_t i = 0; i < blockCount; ++i) {
+        CHECK(processedBlocks[i].first[0] == static_cast<float>(i * stepSize));
+        CHECK(processedBlocks[i].last[0] == static_cast<float>(i * stepSize + blockSize - 1));
+    }
+}
@@ -0,0 +1,159 @@
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "rtvamp/hostsdk/Window.hpp"
+
+using Catch::Approx;
+using rtvamp::hostsdk::WindowType;
+
+TEST_CASE("Window") {
+    SECTION("Values") {
+        const auto hann = rtvamp::hostsdk::getWindow(WindowType::Hann, 5);
+        REQUIRE(hann->size() == 5);
+        CHECK((*hann)[0] == Approx(0.0).margin(1e-7));
+        CHECK((*hann)[1] == Approx(0.5));
+        CHECK((*hann)[2] == Approx(1.0));
+        CHECK((*hann)[3] == Approx(0.5));
+        CHECK((*hann)[4] == Approx(0.0).margin(1e-7));
+
+        const auto hamming = rtvamp::hostsdk::getWindow(WindowType::Hamming, 3);
+        CHECK((*hamming)[0] == Approx(0.08));
+        CHECK((*hamming)[1] == Approx(1.0));
+        CHECK((*hamming)[2] == Approx(0.08));
+
+        const auto blackmanHarris = rtvamp::hostsdk::getWindow(WindowType::BlackmanHarris, 3);
+        CHECK((*blackmanHarris)[0] == Approx(0.00006).margin(1e-7));
+        CHECK((*blackmanHarris)[1] == Approx(1.0));
+
+        // numpy.kaiser(3, 8.6) = [1 / I0(8.6), 1, 1 / I0(8.6)], I0(8.6) = 750.46116
+        const auto kaiser = rtvamp::hostsdk::getWindow(WindowType::Kaiser, 3);
+        CHECK((*kaiser)[0] == Approx(1.0 / 750.46116));
+        CHECK((*kaiser)[1] == Approx(1.0));
+        CHECK((*kaiser)[2] == Approx((*kaiser)[0]));
+
+        const auto rectangular = rtvamp::hostsdk::getWindow(WindowType::Rectangular, 3);
+        CHECK(rectangular->size() == 3);
+        CHECK((*rectangular)[0] == 1.0F);
+
+        CHECK((*rtvamp::hostsdk::getWindow(WindowType::Blackman, 1))[0] == 1.0F);
+        CHECK((*rtvamp::hostsdk::getWindow(WindowType::Kaiser, 1))[0] == 1.0F);
+    }
+
+    SECTION("Symmetric") {
+        const auto type = GENERATE(
+            WindowType::Hann, WindowType::Hamming, WindowType::Blackman, WindowType::BlackmanHarris, WindowType::Kaiser
+        );
+        const auto window = rtvamp::hostsdk::getWindow(type, 1024);
+        for (size_t i = 0; i < window->size() / 2; ++i) {
+            CHECK((*window)[i] == Approx((*window)[window->size() - 1 - i]).margin(1e-6));
+        }
+    }
+
+    SECTION("Cached by type and length") {
+        const auto window1 = rtvamp::hostsdk::getWindow(WindowType::Hann, 512);
+        const auto window2 = rtvamp::hostsdk::getWindow(WindowType::Hann, 512);
+        const auto window3 = rtvamp::hostsdk::getWindow(WindowType::Hann, 256);
+        const auto window4 = rtvamp::hostsdk::getWindow(WindowType::Hamming, 512);
+        const auto window5 = rtvamp::hostsdk::getWindow(WindowType::Hann, 512, 1.0F);  // beta ignored
+        CHECK(window1 == window2);
+        CHECK(window1 != window3);
+        CHECK(window1 != window4);
+        CHECK(window1 == window5);
+
+        const auto kaiser1 = rtvamp::hostsdk::getWindow(WindowType::Kaiser, 512, 5.0F);
+        const auto kaiser2 = rtvamp::hostsdk::getWindow(WindowType::Kaiser, 512, 6.0F);
+        CHECK(kaiser1 != kaiser2);
+    }
+
+    SECTION("Aligned") {
+        const auto window = rtvamp::hostsdk::getWindow(WindowType::Hann, 100);
+        CHECK(reinterpret_cast<uintptr_t>(window->data()) % 64 == 0);  // NOLINT(*reinterpret-cast)
+    }
+}
+
+TEST_CASE("applyWindow") {
+    const std::vector<float> window{0.5F, 1.0F, 2.0F};
+    std::vector<float>       buffer{1.0F, 2.0F, 3.0F};
+
+    rtvamp::hostsdk::applyWindow(buffer, window, buffer);  // in-place
+    CHECK(buffer == std::vector<float>{0.5F, 2.0F, 6.0F});
+
+    std::vector<float> output(2);
+    CHECK_THROWS_AS(rtvamp::hostsdk::applyWindow(buffer, window, output), std::invalid_argument);
+}
+
+template <typename T>
+static void checkDeinterleaveWindow(size_t channelCount, size_t frames, bool windowed, float scale) {
+    CAPTURE(channelCount, frames, windowed);
+
+    std::vector<T> interleaved(channelCount * frames);
+    for (size_t i = 0; i < frames; ++i) {
+        for (size_t c = 0; c < channelCount; ++c) {
+            interleaved[i * channelCount + c] = static_cast<T>(static_cast<int>(c * 100 + i % 50) - 70);
+        }
+    }
+    std::vector<float> window;
+    if (windowed) {
+        const auto table = rtvamp::hostsdk::getWindow(WindowType::Hann, static_cast<uint32_t>(frames));
+        window.assign(table->begin(), table->end());
+    }
+
+    std::vector<std::vector<float>> channels(channelCount, std::vector<float>(frames));
+    std::vector<std::span<float>>   channelSpans(channels.begin(), channels.end());
+    rtvamp::hostsdk::deinterleaveWindow(std::span<const T>(interleaved), window, channelSpans);
+
+    for (size_t c = 0; c < channelCount; ++c) {
+        for (size_t i = 0; i < frames; ++i) {
+            const float expected = static_cast<float>(interleaved[i * channelCount + c]) * scale *
+                (windowed ? window[i] : 1.0F);
+            REQUIRE(channels[c][i] == Approx(expected));
+        }
+    }
+}
+
+TEST_CASE("deinterleaveWindow") {
+    const size_t channelCount = GENERATE(1, 2, 3, 4, 8, 70);
+    const size_t frames       = GENERATE(1, 7, 1024, 1500);
+    const bool   windowed     = GENERATE(true, false);
+
+    checkDeinterleaveWindow<float>(channelCount, frames, windowed, 1.0F);
+    checkDeinterleaveWindow<int16_t>(channelCount, frames, windowed, 1.0F / 32768.0F);
+    checkDeinterleaveWindow<int32_t>(channelCount, frames, windowed, 1.0F / 2147483648.0F);
+}
+
+TEST_CASE("deinterleaveWindow conversion range") {
+    const std::vector<int16_t> interleaved{-32768, 0, 32767, 16384};
+    std::vector<float>         left(2);
+    std::vector<float>         right(2);
+    const std::vector<std::span<float>> channels{left, right};
+    rtvamp::hostsdk::deinterleaveWindow(std::span<const int16_t>(interleaved), {}, channels);
+    CHECK(left == std::vector<float>{-1.0F, 32767.0F / 32768.0F});
+    CHECK(right == std::vector<float>{0.0F, 0.5F});
+}
+
+TEST_CASE("deinterleaveWindow invalid arguments") {
+    const std::vector<float> interleaved(12);
+    const std::vector<float> window(6);
+    std::vector<float>       left(6);
+    std::vector<float>       right(5);
+
+    const std::vector<std::span<float>> noChannels;
+    const std::vector<std::span<float>> channels{left, left};
+    const std::vector<std::span<float>> invalidChannels{left, right};
+    const std::vector<std::span<float>> fiveChannels(5, std::span<float>(left));
+
+    CHECK_THROWS_AS(rtvamp::hostsdk::deinterleaveWindow(interleaved, window, noChannels), std::invalid_argument);
+    CHECK_THROWS_AS(rtvamp::hostsdk::deinterleaveWindow(interleaved, window, fiveChannels), std::invalid_argument);
+    CHECK_THROWS_AS(rtvamp::hostsdk::deinterleaveWindow(interleaved, window, invalidChannels), std::invalid_argument);
+    CHECK_THROWS_AS(
+        rtvamp::hostsdk::deinterleaveWindow(interleaved, std::span(window).first(5), channels), std::invalid_argument
+    );
+    CHECK_NOTHROW(rtvamp::hostsdk::deinterleaveWindow(interleaved, window, channels));
+}
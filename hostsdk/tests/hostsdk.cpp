@@ -76,6 +76,14 @@ TEST_CASE("listLibraries") {
         CHECK_THAT(stems, Contains("example-plugin"));
         CHECK_THAT(stems, !Contains("invalid-plugin"));
     }
+
+    SECTION("Parallel discovery") {
+        const std::vector<std::filesystem::path> paths{searchPath, searchPath};
+        const auto expected = rtvamp::hostsdk::listLibraries(paths);
+        for (unsigned int threads : {0U, 1U, 4U}) {
+            CHECK(rtvamp::hostsdk::listLibraries(paths, {.threads = threads}) == expected);
+        }
+    }
 }
 
 TEST_CASE("loadLibrary") {
@@ -107,6 +115,15 @@ TEST_CASE("listPlugins") {
         REQUIRE_FALSE(plugins.empty());
         REQUIRE_THAT(plugins, Contains(PluginKey("example-plugin:rms")));
     }
+
+    SECTION("Parallel discovery") {
+        const std::vector<std::filesystem::path> paths{searchPath, getLibraryPath("example-plugin")};
+        const auto expected = rtvamp::hostsdk::listPlugins(paths);
+        REQUIRE_THAT(expected, Contains(PluginKey("example-plugin:rms")));
+        for (unsigned int threads : {0U, 1U, 4U}) {
+            CHECK(rtvamp::hostsdk::listPlugins(paths, {.threads = threads}) == expected);
+        }
+    }
 }
 
 TEST_CASE("loadPlugin") {
@@ -3,6 +3,7 @@
 #include "vamp/vamp.h"
 
 #include "rtvamp/pluginsdk/Plugin.hpp"
+#include "rtvamp/pluginsdk/detail/Extension.hpp"
 #include "rtvamp/pluginsdk/detail/PluginAdapter.hpp"
 
 namespace rtvamp::pluginsdk {
@@ -20,6 +21,9 @@ namespace rtvamp::pluginsdk {
  * 3. Use the `RTVAMP_ENTRY_POINT(...)` macro to automatically define and export the entry point.
  *
  *    Example: \include plugin/plugin.cpp
+ *
+ * The optional rt-vamp extension `rtvampGetPluginExtension` (see detail/Extension.hpp) has the same
+ * signature as the EntryPoint::getExtension() method and is exported by the macro as well.
  */
 template <IsPlugin... Plugins>
 class EntryPoint {
@@ -33,12 +37,30 @@ public:
         return descriptors[index];
     }
 
+    static constexpr const RtvampPluginExtension* getExtension(
+        unsigned int hostAbiVersion, const VampPluginDescriptor* descriptor
+    ) {
+        if (hostAbiVersion < 1) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < pluginCount; ++i) {
+            if (descriptors[i] == descriptor) {
+                return extensions[i];
+            }
+        }
+        return nullptr;
+    }
+
 private:
     static constexpr auto pluginCount = sizeof...(Plugins);
 
     static constexpr std::array<const VampPluginDescriptor*, pluginCount> descriptors{
         {detail::PluginAdapter<Plugins>::getDescriptor()...}
     };
+
+    static constexpr std::array<const RtvampPluginExtension*, pluginCount> extensions{
+        {detail::PluginAdapter<Plugins>::getExtension()...}
+    };
 };
 
 }  // namespace rtvamp::pluginsdk
@@ -63,7 +85,8 @@ private:
 #endif
 
 /**
- * Generate entry point for given PluginDefintion types and export symbol with pragma.
+ * Generate entry point (and rt-vamp extension) for given PluginDefintion types and export symbols
+ * with pragma.
  */
 #define RTVAMP_ENTRY_POINT(...)                                                                    \
     extern "C" const VampPluginDescriptor* vampGetPluginDescriptor(                                \
@@ -72,6 +95,15 @@ private:
     ) {                                                                                            \
         RTVAMP_EXPORT_FUNCTION                                                                     \
         return ::rtvamp::pluginsdk::EntryPoint<__VA_ARGS__>::getDescriptor(hostApiVersion, index); \
+    }                                                                                              \
+    extern "C" const RtvampPluginExtension* rtvampGetPluginExtension(                              \
+        unsigned int hostAbiVersion,                                                               \
+        const VampPluginDescriptor* descriptor                                                     \
+    ) {                                                                                            \
+        RTVAMP_EXPORT_FUNCTION                                                                     \
+        return ::rtvamp::pluginsdk::EntryPoint<__VA_ARGS__>::getExtension(                         \
+            hostAbiVersion, descriptor                                                             \
+        );                                                                                         \
     }
 
 // NOLINTEND(*macro-usage)
@@ -17,6 +17,10 @@ static_assert(sizeof(unsigned int) >= sizeof(uint32_t), "Size type must have at
 
 namespace rtvamp::pluginsdk {
 
+namespace detail {
+struct PluginAccess;
+}  // namespace detail
+
 /**
  * Non-templated plugin base class with type definitions.
  */
@@ -46,6 +50,18 @@ public:
         // std::vector<const char*> valueNames{};  // currently not possible -> wait for constexpr vectors
     };
 
+    /** Resolved parameter (index of Plugin::parameters) to get/set values without identifier lookup. */
+    struct ParameterHandle {
+        uint32_t index = 0;
+    };
+
+    /** Parameter change at a sample offset within the processed block (see PluginExt). */
+    struct ParameterEvent {
+        uint32_t        offset = 0;  ///< Sample offset within the block
+        ParameterHandle parameter;
+        float           value  = 0.0F;
+    };
+
     struct OutputDescriptor {
         std::string               identifier;
         std::string               name;
@@ -59,10 +75,47 @@ public:
         std::optional<float>      quantizeStep    = std::nullopt;
     };
 
-    using TimeDomainBuffer      = std::span<const float>;  ///< Time domain buffer
-    using FrequencyDomainBuffer = std::span<const std::complex<float>>;  ///< Frequency domain buffer (FFT)
-    using InputBuffer           = std::variant<TimeDomainBuffer, FrequencyDomainBuffer>;  ///< Input domain variant
-    using Feature               = std::vector<float>;  ///< Feature with one or more values (defined by OutputDescriptor::binCount)
+    /**
+     * Output descriptor for compile-time evaluation (see Plugin::outputs).
+     *
+     * Mapped to the C API at compile time without any copies. Bin names must be either empty or
+     * have `binCount` elements.
+     */
+    struct StaticOutputDescriptor {
+        // use const char* for compile-time evaluation and mapping to C API
+        const char*                  identifier      = "";
+        const char*                  name            = "";
+        const char*                  description     = "";
+        const char*                  unit            = "";
+        uint32_t                     binCount        = 1;
+        std::span<const char* const> binNames        = {};  // NOLINT(*redundant-member-init)
+        bool                         hasKnownExtents = false;
+        float                        minValue        = 0.0F;
+        float                        maxValue        = 0.0F;
+        std::optional<float>         quantizeStep    = std::nullopt;
+    };
+
+    using TimeDomainBuffer        = std::span<const float>;  ///< Time domain buffer
+    using FrequencyDomainBuffer   = std::span<const std::complex<float>>;  ///< Frequency domain buffer (FFT)
+    using TimeDomainChannels      = std::span<const TimeDomainBuffer>;  ///< Time domain buffers of each channel (planar)
+    using FrequencyDomainChannels = std::span<const FrequencyDomainBuffer>;  ///< Frequency domain buffers of each channel (planar)
+    using InputBuffer             = std::variant<
+        TimeDomainBuffer,
+        FrequencyDomainBuffer,
+        TimeDomainChannels,
+        FrequencyDomainChannels
+    >;  ///< Input domain variant (multi-channel alternatives if Meta::maxChannelCount > 1)
+    using Feature                 = std::vector<float>;  ///< Feature with one or more values (defined by OutputDescriptor::binCount)
+    using ParameterEventList      = std::span<const ParameterEvent>;  ///< Parameter events sorted by offset
+
+protected:
+    /** Number of input channels (set by the host before initialise). */
+    uint32_t getInputChannelCount() const noexcept { return inputChannelCount_; }
+
+private:
+    friend struct detail::PluginAccess;
+
+    uint32_t inputChannelCount_ = 1;
 };
 
 /**
@@ -86,21 +139,57 @@ public:
 
     static constexpr uint32_t outputCount = NOutputs;  ///< Number of outputs (defined by template parameter)
 
-    /** Static plugin descriptor */
+    /**
+     * Static plugin descriptor.
+     *
+     * Plugins with `maxChannelCount > 1` receive the planar multi-channel buffers
+     * (#TimeDomainChannels or #FrequencyDomainChannels) in process, all other plugins receive
+     * single-channel buffers (#TimeDomainBuffer or #FrequencyDomainBuffer).
+     *
+     * `stateless` and `warmUpLength` tell offline hosts if a long signal can be split into
+     * segments, which are processed in parallel by separate instances. Stateless plugins compute
+     * the features of a block only from the block itself. Stateful plugins with a bounded memory
+     * declare the number of input samples (per channel) preceding a block, after which their state
+     * is independent of any earlier input. The default (stateful, warm-up length 0) means unknown
+     * and prevents sharding.
+     */
     struct Meta {
-        const char*  identifier    = "";
-        const char*  name          = "";
-        const char*  description   = "";
-        const char*  maker         = "";
-        const char*  copyright     = "";
-        int          pluginVersion = 1;
-        InputDomain  inputDomain   = InputDomain::Time;
+        const char*  identifier      = "";
+        const char*  name            = "";
+        const char*  description     = "";
+        const char*  maker           = "";
+        const char*  copyright       = "";
+        int          pluginVersion   = 1;
+        InputDomain  inputDomain     = InputDomain::Time;
+        uint32_t     minChannelCount = 1;
+        uint32_t     maxChannelCount = 1;
+        bool         stateless       = false;
+        uint32_t     warmUpLength    = 0;
     };
 
     static constexpr Meta                               meta{};        ///< Required static plugin descriptor
     static constexpr std::array<ParameterDescriptor, 0> parameters{};  ///< Optional parameter descriptors (default: none)
     static constexpr std::array<const char*, 0>         programs{};    ///< Optional program list (default: none)
 
+    /**
+     * Optional static output descriptors (default: none).
+     *
+     * If the output descriptors do not change at runtime (e.g. depending on parameters), declare
+     * them as `static constexpr std::array outputs` and implement getOutputDescriptors with
+     * `return makeOutputList(outputs);`. The C API descriptors are then generated at compile time
+     * and the host can query them without any allocations.
+     */
+    static constexpr std::array<StaticOutputDescriptor, 0> outputs{};
+
+    /**
+     * Optional number of instances kept for reuse after cleanup (default: 0, no pooling).
+     *
+     * Pooled instances keep their allocated buffers. Before reuse, the first program is selected,
+     * the parameters are set to their default values and the plugin is reset. Instances are only
+     * reused for the same input sample rate.
+     */
+    static constexpr size_t instancePoolSize = 0;
+
     virtual std::optional<float> getParameter(std::string_view id) const { return {}; }
     virtual bool                 setParameter(std::string_view id, float value) { return false; } 
 
@@ -120,11 +209,32 @@ protected:
     float       getInputSampleRate() const noexcept { return inputSampleRate_; };
     FeatureSet& getFeatureSet() noexcept { return featureSet_; }
 
+    /** Convert static output descriptors to an output list (see #outputs). */
+    static OutputList makeOutputList(const std::array<StaticOutputDescriptor, NOutputs>& outputs) {
+        OutputList result;
+        for (size_t i = 0; i < NOutputs; ++i) {
+            const auto& output = outputs[i];
+            result[i] = OutputDescriptor{
+                .identifier      = output.identifier,
+                .name            = output.name,
+                .description     = output.description,
+                .unit            = output.unit,
+                .binCount        = output.binCount,
+                .binNames        = {output.binNames.begin(), output.binNames.end()},
+                .hasKnownExtents = output.hasKnownExtents,
+                .minValue        = output.minValue,
+                .maxValue        = output.maxValue,
+                .quantizeStep    = output.quantizeStep,
+            };
+        }
+        return result;
+    }
+
     void initialiseFeatureSet() {
-        const auto outputs     = getOutputDescriptors();
+        const auto descriptors = getOutputDescriptors();
         auto&      featureSet  = getFeatureSet();
         for (size_t i = 0; i < outputCount; ++i) {
-            featureSet[i].resize(outputs[i].binCount);
+            featureSet[i].resize(descriptors[i].binCount);
         }
     }
 
@@ -145,6 +255,19 @@ concept HasPrograms = requires {
     { T::programs } -> std::convertible_to<std::array<const char*, T::programs.size()>>;
 };
 
+template <typename T>
+concept HasStaticOutputs = T::outputCount > 0 && requires {
+    { T::outputs } -> std::convertible_to<std::array<PluginBase::StaticOutputDescriptor, T::outputCount>>;
+};
+
+template <typename T>
+concept HasParameterHandles = requires(
+    T plugin, const T constPlugin, PluginBase::ParameterHandle handle, float value
+) {
+    { constPlugin.getParameter(handle) } -> std::same_as<std::optional<float>>;
+    { plugin.setParameter(handle, value) } -> std::same_as<bool>;
+};
+
 template <typename T>
 concept IsPlugin = std::constructible_from<T, float> && requires(
     T plugin,
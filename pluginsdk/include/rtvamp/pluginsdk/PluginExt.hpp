@@ -1,11 +1,12 @@
 #pragma once
 
-#include <algorithm>  // clamp
+#include <algorithm>  // clamp, min
 #include <array>
 #include <cassert>
 #include <cmath>  // round
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -21,6 +22,22 @@ namespace rtvamp::pluginsdk {
  *    (this pattern is known as the curiously recurring template pattern (CRTP))
  * 2. number of outputs
  * 
+ * Parameters can be accessed by handles, resolved at compile time with resolveParameter, to avoid
+ * the identifier lookup (e.g. automation of parameters per block):
+ *
+ *     constexpr auto gain = MyPlugin::resolveParameter("gain");
+ *     plugin.setParameter(gain, 0.5F);
+ *
+ * Hosts can schedule parameter changes at sample offsets within a block (sample-accurate
+ * automation). Plugins opt in by splitting the block with forEachParameterSegment in process:
+ *
+ *     forEachParameterSegment(blockSize, [&](uint32_t begin, uint32_t end) {
+ *         // process samples [begin, end) with the current parameter values
+ *     });
+ *
+ * Otherwise the events are applied at block boundaries: events at offset 0 before the block, all
+ * other events after the block.
+ *
  * Assumptions:
  * - first program is enabled by default -> default parameters should match program settings
  */
@@ -32,6 +49,14 @@ public:
     std::optional<float> getParameter(std::string_view id) const final;
     bool                 setParameter(std::string_view id, float value) final;
 
+    using ParameterHandle = PluginBase::ParameterHandle;
+
+    /** Resolve parameter identifier at compile time (compile error if the parameter is unknown). */
+    static consteval ParameterHandle resolveParameter(std::string_view id);
+
+    std::optional<float> getParameter(ParameterHandle handle) const;
+    bool                 setParameter(ParameterHandle handle, float value);
+
     std::string_view     getCurrentProgram() const final;
     bool                 selectProgram(std::string_view name) final;
 
@@ -39,13 +64,34 @@ public:
     virtual void         onParameterChange(std::string_view id, float newValue) {}
     virtual void         onProgramChange(std::string_view newProgram) {}
 
+protected:
+    using ParameterEventList = PluginBase::ParameterEventList;
+
+    /**
+     * Split the block at the offsets of the scheduled parameter events.
+     *
+     * The events are applied (setParameter, onParameterChange) before the callback is invoked with
+     * the sample range `[begin, end)` of each segment. Without events, the callback is invoked once
+     * for the whole block. Must be called at most once per process call.
+     * @param sampleCount Number of samples in the block
+     * @param callback Callable with signature `void(uint32_t begin, uint32_t end)`
+     */
+    template <typename Callback>
+    void forEachParameterSegment(uint32_t sampleCount, Callback&& callback);
+
 private:
+    friend struct detail::PluginAccess;
+
+    void beginParameterEvents(ParameterEventList events);
+    void endParameterEvents();
+
     static           std::vector<float>    defaultParameterValues();
     static constexpr std::optional<size_t> findParameterIndex(std::string_view id);
     static constexpr std::optional<size_t> findProgramIndex(std::string_view name);
 
     std::vector<float> parameterValues_{defaultParameterValues()};
     size_t             programIndex_{0};
+    ParameterEventList parameterEvents_;  ///< pending events of the processed block
 };
 
 /* --------------------------------------- Implementation --------------------------------------- */
@@ -61,19 +107,84 @@ std::optional<float> PluginExt<Self, NOutputs>::getParameter(std::string_view id
 template <typename Self, uint32_t NOutputs>
 bool PluginExt<Self, NOutputs>::setParameter(std::string_view id, float value) {
     if (const auto index = findParameterIndex(id)) {
-        const auto& descriptor = Self::parameters[index.value()];
+        return setParameter(ParameterHandle{static_cast<uint32_t>(index.value())}, value);
+    }
+    return false;
+}
 
-        if (descriptor.quantizeStep) {
-            const auto quantizeStep = descriptor.quantizeStep.value();
-            value = std::round(value / quantizeStep) * quantizeStep;
+template <typename Self, uint32_t NOutputs>
+consteval typename PluginExt<Self, NOutputs>::ParameterHandle PluginExt<Self, NOutputs>::resolveParameter(
+    std::string_view id
+) {
+    const auto index = findParameterIndex(id);
+    if (!index) {
+        throw "Unknown parameter identifier";  // not a constant expression -> compile error
+    }
+    return ParameterHandle{static_cast<uint32_t>(index.value())};
+}
+
+template <typename Self, uint32_t NOutputs>
+std::optional<float> PluginExt<Self, NOutputs>::getParameter(ParameterHandle handle) const {
+    if (handle.index >= Self::parameters.size()) {
+        return {};
+    }
+    return parameterValues_[handle.index];
+}
+
+template <typename Self, uint32_t NOutputs>
+bool PluginExt<Self, NOutputs>::setParameter(ParameterHandle handle, float value) {
+    if (handle.index >= Self::parameters.size()) {
+        return false;
+    }
+    const auto& descriptor = Self::parameters[handle.index];
+
+    if (descriptor.quantizeStep) {
+        const auto quantizeStep = descriptor.quantizeStep.value();
+        value = std::round(value / quantizeStep) * quantizeStep;
+    }
+    value = std::clamp(value, descriptor.minValue, descriptor.maxValue);
+
+    parameterValues_[handle.index] = value;
+    onParameterChange(descriptor.identifier, value);
+    return true;
+}
+
+template <typename Self, uint32_t NOutputs>
+template <typename Callback>
+void PluginExt<Self, NOutputs>::forEachParameterSegment(uint32_t sampleCount, Callback&& callback) {
+    uint32_t begin = 0;
+    while (!parameterEvents_.empty()) {
+        const auto& event = parameterEvents_.front();
+        const auto  end   = std::min(event.offset, sampleCount);
+        if (end > begin) {
+            callback(begin, end);
+            begin = end;
         }
-        value = std::clamp(value, descriptor.minValue, descriptor.maxValue);
+        setParameter(event.parameter, event.value);
+        parameterEvents_ = parameterEvents_.subspan(1);
+    }
+    if (begin < sampleCount) {
+        callback(begin, sampleCount);
+    }
+}
 
-        parameterValues_[index.value()] = value;
-        onParameterChange(id, value);
-        return true;
+template <typename Self, uint32_t NOutputs>
+void PluginExt<Self, NOutputs>::beginParameterEvents(ParameterEventList events) {
+    // events at the block start are applied immediately (same result with or without segments)
+    while (!events.empty() && events.front().offset == 0) {
+        setParameter(events.front().parameter, events.front().value);
+        events = events.subspan(1);
     }
-    return false;
+    parameterEvents_ = events;
+}
+
+template <typename Self, uint32_t NOutputs>
+void PluginExt<Self, NOutputs>::endParameterEvents() {
+    // apply events not consumed by forEachParameterSegment
+    for (const auto& event : parameterEvents_) {
+        setParameter(event.parameter, event.value);
+    }
+    parameterEvents_ = {};
 }
 
 template <typename Self, uint32_t NOutputs>
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+
+#include "vamp/vamp.h"
+
+/**
+ * rt-vamp extension of the Vamp C ABI.
+ *
+ * Plugin libraries built with the rt-vamp pluginsdk export the optional symbol
+ * `rtvampGetPluginExtension` (see RTVAMP_ENTRY_POINT) next to `vampGetPluginDescriptor`.
+ * Hosts built with the rt-vamp hostsdk detect the symbol and call the plugins directly, without
+ * the sec/nsec split of the timestamp and without marshalling the features into VampFeatureLists.
+ * Other Vamp hosts and plugins are not affected.
+ *
+ * The layout is versioned with RTVAMP_EXTENSION_ABI_VERSION. New members are only appended and
+ * must only be accessed if RtvampPluginExtension::abiVersion is high enough.
+ */
+
+// NOLINTBEGIN(modernize-use-using, *macro-usage)
+
+#define RTVAMP_EXTENSION_ABI_VERSION 3
+
+extern "C" {
+
+/** Feature values of a single output (owned by the plugin). */
+typedef struct _RtvampFeature {
+    const float* values;
+    unsigned int valueCount;
+} RtvampFeature;
+
+/** Parameter change at a sample offset within the processed block (version 2). */
+typedef struct _RtvampParameterEvent {
+    unsigned int offset;  ///< Sample offset within the block
+    unsigned int parameterIndex;  ///< Index of VampPluginDescriptor::parameters
+    float value;
+} RtvampParameterEvent;
+
+typedef struct _RtvampPluginExtension {
+    /** ABI version of the plugin, defines the available members. */
+    unsigned int abiVersion;
+
+    /**
+     * Process a single block (version 1).
+     * @param handle Plugin handle created with VampPluginDescriptor::instantiate
+     * @param inputBuffers Input buffers of each channel with the initialised block size (time
+     *                     domain) or interleaved complex values of size `blockSize / 2 + 1`
+     *                     (frequency domain)
+     * @param nsec Timestamp in nanoseconds
+     * @return Features for each output (valid until the next call) or `NULL` on error
+     */
+    const RtvampFeature* (*process)(VampPluginHandle handle, const float* const* inputBuffers, uint64_t nsec);
+
+    /**
+     * Process a single block with parameter changes within the block (version 2).
+     * Same as process, but the plugin applies the parameter events at their sample offsets (if
+     * supported by the plugin) or at the block boundaries, without a call per event.
+     * @param events Parameter events sorted by offset (only valid during the call)
+     * @param eventCount Number of parameter events
+     */
+    const RtvampFeature* (*processWithParameterEvents)(
+        VampPluginHandle handle,
+        const float* const* inputBuffers,
+        uint64_t nsec,
+        const RtvampParameterEvent* events,
+        unsigned int eventCount
+    );
+
+    /** Non-zero if the features of a block only depend on the block itself (version 3). */
+    unsigned int stateless;
+
+    /**
+     * Number of input samples (per channel) preceding a block, after which the state of the plugin
+     * is independent of earlier input, or 0 if unknown (version 3).
+     */
+    unsigned int warmUpLength;
+} RtvampPluginExtension;
+
+/**
+ * Get the extension of a plugin in the library.
+ * @param hostAbiVersion Extension ABI version of the host
+ * @param descriptor Plugin descriptor returned by `vampGetPluginDescriptor`
+ * @return `NULL` if the descriptor is unknown or the ABI version is not supported
+ */
+typedef const RtvampPluginExtension* (*RtvampGetPluginExtensionFunction)(
+    unsigned int hostAbiVersion, const VampPluginDescriptor* descriptor
+);
+
+}
+
+// NOLINTEND(modernize-use-using, *macro-usage)
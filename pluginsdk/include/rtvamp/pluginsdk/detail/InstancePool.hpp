@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace rtvamp::pluginsdk::detail {
+
+/**
+ * Lock-free pool of heap-allocated objects with a fixed capacity.
+ *
+ * Ownership of the objects is transferred with acquire and release. Objects left in the pool are
+ * deleted with the pool.
+ */
+template <typename T, size_t Capacity>
+class InstancePool {
+public:
+    InstancePool() = default;
+    ~InstancePool() {
+        for (auto& slot : slots_) {
+            delete slot.exchange(nullptr);  // NOLINT(*owning-memory)
+        }
+    }
+
+    InstancePool(const InstancePool&)            = delete;
+    InstancePool(InstancePool&&)                 = delete;
+    InstancePool& operator=(const InstancePool&) = delete;
+    InstancePool& operator=(InstancePool&&)      = delete;
+
+    /**
+     * Take an object matching the predicate out of the pool.
+     * @return Object or `nullptr` if no matching object is available
+     */
+    template <typename Predicate>
+    T* acquire(Predicate&& predicate) {
+        for (auto& slot : slots_) {
+            if (slot.load(std::memory_order_relaxed) == nullptr) {
+                continue;
+            }
+            T* object = slot.exchange(nullptr, std::memory_order_acquire);
+            if (object == nullptr) {
+                continue;  // taken by another thread
+            }
+            if (predicate(*object)) {
+                return object;
+            }
+            release(object);  // put back
+        }
+        return nullptr;
+    }
+
+    /** Put an object into the pool or delete it if the pool is full. */
+    void release(T* object) {
+        for (auto& slot : slots_) {
+            T* expected = nullptr;
+            if (slot.compare_exchange_strong(expected, object, std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+        delete object;  // NOLINT(*owning-memory)
+    }
+
+private:
+    std::array<std::atomic<T*>, Capacity> slots_{};
+};
+
+}  // namespace rtvamp::pluginsdk::detail
@@ -5,50 +5,95 @@
 #include <atomic>
 #include <cassert>
 #include <complex>
-#include <memory>
-#include <mutex>
+#include <concepts>  // derived_from
+#include <span>
+#include <type_traits>  // conditional_t
 #include <utility>  // cmp_less
 #include <vector>
 
 #include "rtvamp/pluginsdk/Plugin.hpp"
+#include "rtvamp/pluginsdk/PluginExt.hpp"
+#include "rtvamp/pluginsdk/detail/Extension.hpp"
+#include "rtvamp/pluginsdk/detail/InstancePool.hpp"
 #include "rtvamp/pluginsdk/detail/macros.hpp"
 #include "rtvamp/pluginsdk/detail/VampWrapper.hpp"
 
 namespace rtvamp::pluginsdk::detail {
 
+/** Access to private members of the plugin base class. */
+struct PluginAccess {
+    static void setInputChannelCount(PluginBase& plugin, uint32_t channelCount) noexcept {
+        plugin.inputChannelCount_ = channelCount;
+    }
+
+    template <typename Self, uint32_t NOutputs>
+    static void beginParameterEvents(PluginExt<Self, NOutputs>& plugin, PluginBase::ParameterEventList events) {
+        plugin.beginParameterEvents(events);
+    }
+
+    template <typename Self, uint32_t NOutputs>
+    static void endParameterEvents(PluginExt<Self, NOutputs>& plugin) {
+        plugin.endParameterEvents();
+    }
+};
+
 template <IsPlugin TPlugin>
 class PluginAdapter {
 public:
+    static_assert(TPlugin::meta.minChannelCount >= 1, "Minimum channel count must be >= 1");
+    static_assert(
+        TPlugin::meta.minChannelCount <= TPlugin::meta.maxChannelCount,
+        "Minimum channel count must be <= maximum channel count"
+    );
+
     static constexpr const VampPluginDescriptor* getDescriptor() { return &descriptor; }
+    static constexpr const RtvampPluginExtension* getExtension() { return &extension; }
 
 private:
     class Instance;
-    class InstanceMap;
-
-    inline static std::mutex mutex;
-    inline static std::vector<std::unique_ptr<Instance>> instances;
 
     static Instance* getInstance(VampPluginHandle handle) {
         return reinterpret_cast<Instance*>(handle);  // NOLINT
     }
 
+    inline static InstancePool<Instance, TPlugin::instancePoolSize> pool;
+
+    /**
+     * Create instance owned by the host via the handle (released with cleanup).
+     * No global registry, instantiate and cleanup do not synchronize between threads.
+     * Instances are recycled from the pool if TPlugin::instancePoolSize > 0.
+     */
     static VampPluginHandle instantiate(const VampPluginDescriptor* desc, float inputSampleRate) {
         // should the host create instances with others descriptors? -> shared state
         // possible solution: overwrite function pointer in entry point and dispatch to adapters there
         if (desc != &descriptor) {
             return nullptr;
         }
-
-        const std::scoped_lock lock{mutex};
-        auto& adapter = instances.emplace_back(
-            std::make_unique<Instance>(inputSampleRate)
-        );
-        return adapter.get();
+        if constexpr (TPlugin::instancePoolSize > 0) {
+            auto* instance = pool.acquire([&](const Instance& candidate) {
+                return candidate.getInputSampleRate() == inputSampleRate;
+            });
+            if (instance != nullptr) {
+                return instance;
+            }
+        }
+        try {
+            return new Instance(inputSampleRate);  // NOLINT(*owning-memory)
+        } catch (const std::exception& e) {
+            RTVAMP_ERROR("rtvamp::Plugin::instantiate: ", e.what());
+            return nullptr;
+        }
     }
 
     static void cleanup(VampPluginHandle handle) {
-        const std::scoped_lock lock{mutex};
-        std::erase_if(instances, [&](const auto& adapter) { return adapter.get() == handle; });
+        auto* instance = getInstance(handle);
+        if constexpr (TPlugin::instancePoolSize > 0) {
+            if (instance != nullptr && instance->recycle()) {
+                pool.release(instance);
+                return;
+            }
+        }
+        delete instance;  // NOLINT(*owning-memory)
     }
 
     static constexpr auto parameters = [] {
@@ -85,6 +130,44 @@ private:
         return result;
     }();
 
+    static constexpr auto staticOutputs = [] {
+        std::array<VampOutputDescriptor, HasStaticOutputs<TPlugin> ? TPlugin::outputCount : 0> result{};
+        if constexpr (HasStaticOutputs<TPlugin>) {
+            static_assert(
+                std::ranges::all_of(
+                    TPlugin::outputs,
+                    [](const auto& o) { return o.binNames.empty() || o.binNames.size() == o.binCount; }
+                ),
+                "Bin names must be either empty or match the bin count"
+            );
+            std::transform(
+                TPlugin::outputs.begin(),
+                TPlugin::outputs.end(),
+                result.begin(),
+                [](const auto& o) {
+                    VampOutputDescriptor native{};
+                    native.identifier       = o.identifier;
+                    native.name             = o.name;
+                    native.description      = o.description;
+                    native.unit             = o.unit;
+                    native.hasFixedBinCount = 1;
+                    native.binCount         = o.binCount;
+                    native.binNames         = o.binNames.empty() ? nullptr : const_cast<const char**>(o.binNames.data());
+                    native.hasKnownExtents  = static_cast<int>(o.hasKnownExtents);
+                    native.minValue         = o.minValue;
+                    native.maxValue         = o.maxValue;
+                    native.isQuantized      = static_cast<int>(o.quantizeStep.has_value());
+                    native.quantizeStep     = o.quantizeStep.value_or(0.0F);
+                    native.sampleType       = vampOneSamplePerStep;
+                    native.sampleRate       = 0.0F;
+                    native.hasDuration      = 0;
+                    return native;
+                }
+            );
+        }
+        return result;
+    }();
+
     static constexpr VampPluginDescriptor descriptor = [] {
         VampPluginDescriptor d{};
         d.vampApiVersion = 2;
@@ -152,11 +235,11 @@ private:
         };
 
         d.getMinChannelCount = [](VampPluginHandle) -> unsigned int {
-            return 1;
+            return TPlugin::meta.minChannelCount;
         };
 
         d.getMaxChannelCount = [](VampPluginHandle) -> unsigned int {
-            return 1;
+            return TPlugin::meta.maxChannelCount;
         };
 
         d.getOutputCount = [](VampPluginHandle) {
@@ -164,15 +247,26 @@ private:
         };
 
         d.getOutputDescriptor = [](VampPluginHandle handle, unsigned int index) -> VampOutputDescriptor* {
-            return handle != nullptr ?
-                getInstance(handle)->getOutputDescriptor(index)
-                : nullptr;
+            if constexpr (HasStaticOutputs<TPlugin>) {
+                if (index >= TPlugin::outputCount) {
+                    RTVAMP_ERROR("rtvamp::Plugin::getOutputDescriptor: index out of bounds");
+                    return nullptr;
+                }
+                // compile-time descriptor, never modified by the host
+                return const_cast<VampOutputDescriptor*>(&staticOutputs[index]);  // NOLINT(*const-cast)
+            } else {
+                return handle != nullptr ?
+                    getInstance(handle)->getOutputDescriptor(index)
+                    : nullptr;
+            }
         };
 
         d.releaseOutputDescriptor = [](VampOutputDescriptor* descriptor) {
-            if (descriptor != nullptr) {
-                clear(*descriptor);
-                delete descriptor;  // NOLINT
+            if constexpr (!HasStaticOutputs<TPlugin>) {
+                if (descriptor != nullptr) {
+                    clear(*descriptor);
+                    delete descriptor;  // NOLINT
+                }
             }
         };
 
@@ -192,6 +286,34 @@ private:
 
         return d;
     }();
+
+    static constexpr RtvampPluginExtension extension = [] {
+        RtvampPluginExtension e{};
+        e.abiVersion = RTVAMP_EXTENSION_ABI_VERSION;
+
+        e.process = [](VampPluginHandle handle, const float* const* inputBuffers, uint64_t nsec) {
+            return handle != nullptr
+                ? getInstance(handle)->processNative(inputBuffers, nsec)
+                : nullptr;
+        };
+
+        e.processWithParameterEvents = [](
+            VampPluginHandle            handle,
+            const float* const*         inputBuffers,
+            uint64_t                    nsec,
+            const RtvampParameterEvent* events,
+            unsigned int                eventCount
+        ) {
+            return handle != nullptr
+                ? getInstance(handle)->processNative(inputBuffers, nsec, std::span(events, eventCount))
+                : nullptr;
+        };
+
+        e.stateless    = TPlugin::meta.stateless ? 1 : 0;
+        e.warmUpLength = TPlugin::meta.warmUpLength;
+
+        return e;
+    }();
 };
 
 /* ------------------------------------------ Instance ------------------------------------------ */
@@ -199,7 +321,8 @@ private:
 template <IsPlugin TPlugin>
 class PluginAdapter<TPlugin>::Instance {
 public:
-    explicit Instance(float inputSampleRate) : plugin_(inputSampleRate) {
+    explicit Instance(float inputSampleRate)
+        : plugin_(inputSampleRate), inputSampleRate_(inputSampleRate) {
         std::generate(
             featureLists_.begin(),
             featureLists_.end(),
@@ -220,10 +343,27 @@ public:
     Instance& operator=(const Instance&) = delete;
     Instance& operator=(Instance&&)      = delete;
 
-    int initialise(unsigned int /* inputChannels */, unsigned int stepSize, unsigned int blockSize) {
+    int initialise(unsigned int inputChannels, unsigned int stepSize, unsigned int blockSize) {
+        if (inputChannels < TPlugin::meta.minChannelCount || inputChannels > TPlugin::meta.maxChannelCount) {
+            RTVAMP_ERROR("rtvamp::Plugin::initialise: unsupported channel count");
+            return 0;
+        }
         blockSize_ = blockSize;
+        channels_.resize(isMultiChannel ? inputChannels : 0);
+        PluginAccess::setInputChannelCount(plugin_, inputChannels);
         try {
             const bool success = plugin_.initialise(stepSize, blockSize);
+            // allocate feature values upfront, process must not allocate
+            if constexpr (HasStaticOutputs<TPlugin>) {
+                for (size_t i = 0; i < TPlugin::outputCount; ++i) {
+                    resizeValues(*featureLists_[i].features, TPlugin::outputs[i].binCount);
+                }
+            } else {
+                const auto outputs = plugin_.getOutputDescriptors();
+                for (size_t i = 0; i < TPlugin::outputCount; ++i) {
+                    resizeValues(*featureLists_[i].features, outputs[i].binCount);
+                }
+            }
             return success ? 1 : 0;
         } catch (const std::exception& e) {
             RTVAMP_ERROR("rtvamp::Plugin::initialise: ", e.what());
@@ -231,6 +371,23 @@ public:
         }
     }
 
+    /** Restore the state of a new instance for reuse (see Plugin::instancePoolSize). */
+    bool recycle() {
+        try {
+            if constexpr (!TPlugin::programs.empty()) {
+                plugin_.selectProgram(TPlugin::programs[0]);
+            }
+            for (uint32_t i = 0; i < TPlugin::parameters.size(); ++i) {
+                setPluginParameter(i, TPlugin::parameters[i].defaultValue);
+            }
+            plugin_.reset();
+            return true;
+        } catch (const std::exception& e) {
+            RTVAMP_ERROR("rtvamp::Plugin::reset: ", e.what());
+            return false;
+        }
+    }
+
     void reset() {
         try {
             plugin_.reset();
@@ -245,7 +402,11 @@ public:
             return 0.0F;
         }
         try {
-            return plugin_.getParameter(TPlugin::parameters[index].identifier).value_or(0.0F); 
+            if constexpr (HasParameterHandles<TPlugin>) {
+                return plugin_.getParameter(PluginBase::ParameterHandle{static_cast<uint32_t>(index)}).value_or(0.0F);
+            } else {
+                return plugin_.getParameter(TPlugin::parameters[index].identifier).value_or(0.0F);
+            }
         } catch (const std::exception& e) {
             RTVAMP_ERROR("rtvamp::Plugin::getParameter: ", e.what());
             return 0.0F;
@@ -258,7 +419,7 @@ public:
             return;
         }
         try {
-            plugin_.setParameter(TPlugin::parameters[index].identifier, value);
+            setPluginParameter(static_cast<uint32_t>(index), value);
         } catch (const std::exception& e) {
             RTVAMP_ERROR("rtvamp::Plugin::setParameter: ", e.what());
         }
@@ -303,22 +464,10 @@ public:
     }
 
     VampFeatureList* process(const float* const* inputBuffers, int sec, int nsec) {
-        const auto*   buffer    = *inputBuffers;  // only first channel
         const int64_t timestamp = static_cast<int64_t>(1'000'000'000) * sec + nsec;
 
-        const auto getInputBuffer = [&]() -> typename TPlugin::InputBuffer {
-            if constexpr (TPlugin::meta.inputDomain == TPlugin::InputDomain::Time) {
-                return std::span(buffer, blockSize_);
-            } else {
-                // casts between interleaved arrays and std::complex are guaranteed to be valid
-                // https://en.cppreference.com/w/cpp/numeric/complex
-                // NOLINTNEXTLINE(*reinterpret-cast)
-                return std::span(reinterpret_cast<const std::complex<float>*>(buffer), blockSize_ / 2 + 1);
-            }
-        };
-
         try {
-            const auto& result = plugin_.process(getInputBuffer(), timestamp);
+            const auto& result = plugin_.process(makeInputBuffer(inputBuffers), timestamp);
             assert(result.size() == TPlugin::outputCount);
             for (size_t i = 0; i < TPlugin::outputCount; ++i) {
                 auto& featureList = featureLists_[i];
@@ -333,13 +482,125 @@ public:
         return featureListsEmpty_.data();
     }
 
+    const RtvampFeature* processNative(const float* const* inputBuffers, uint64_t nsec) {
+        try {
+            const auto& result = plugin_.process(makeInputBuffer(inputBuffers), nsec);
+            assert(result.size() == TPlugin::outputCount);
+            for (size_t i = 0; i < TPlugin::outputCount; ++i) {
+                // reference the feature memory of the plugin, no copy
+                features_[i].values     = result[i].data();
+                features_[i].valueCount = static_cast<unsigned int>(result[i].size());
+            }
+            return features_.data();
+        } catch (const std::exception& e) {
+            RTVAMP_ERROR("rtvamp::Plugin::process: ", e.what());
+        }
+        return nullptr;
+    }
+
+    const RtvampFeature* processNative(
+        const float* const* inputBuffers, uint64_t nsec, std::span<const RtvampParameterEvent> events
+    ) {
+        try {
+            parameterEvents_.clear();  // keeps capacity, only allocates for more events than before
+            for (const auto& event : events) {
+                if (!isValidParameterIndex(event.parameterIndex)) {
+                    RTVAMP_ERROR("rtvamp::Plugin::process: parameter index out of bounds");
+                    continue;
+                }
+                parameterEvents_.push_back({
+                    .offset    = event.offset,
+                    .parameter = PluginBase::ParameterHandle{event.parameterIndex},
+                    .value     = event.value,
+                });
+            }
+            beginParameterEvents();
+        } catch (const std::exception& e) {
+            RTVAMP_ERROR("rtvamp::Plugin::process: ", e.what());
+            return nullptr;
+        }
+        const auto* features = processNative(inputBuffers, nsec);
+        try {
+            endParameterEvents();
+        } catch (const std::exception& e) {
+            RTVAMP_ERROR("rtvamp::Plugin::process: ", e.what());
+        }
+        return features;
+    }
+
     VampFeatureList* getRemainingFeatures() {
         return featureListsEmpty_.data();
     }
 
     const TPlugin& get() const noexcept { return plugin_; }
+    float getInputSampleRate() const noexcept { return inputSampleRate_; }
 
 private:
+    static constexpr bool isTimeDomain   = TPlugin::meta.inputDomain == TPlugin::InputDomain::Time;
+    static constexpr bool isMultiChannel = TPlugin::meta.maxChannelCount > 1;
+    static constexpr bool isPluginExt    = std::derived_from<TPlugin, PluginExt<TPlugin, TPlugin::outputCount>>;
+
+    using ChannelBuffer = std::conditional_t<
+        isTimeDomain, typename TPlugin::TimeDomainBuffer, typename TPlugin::FrequencyDomainBuffer
+    >;
+
+    /** Pass parameter events to PluginExt (sample-accurate) or apply events at block start. */
+    void beginParameterEvents() {
+        if constexpr (isPluginExt) {
+            PluginAccess::beginParameterEvents(plugin_, parameterEvents_);
+        } else {
+            for (const auto& event : parameterEvents_) {
+                if (event.offset == 0) {
+                    setPluginParameter(event.parameter.index, event.value);
+                }
+            }
+        }
+    }
+
+    /** Apply remaining parameter events after the block. */
+    void endParameterEvents() {
+        if constexpr (isPluginExt) {
+            PluginAccess::endParameterEvents(plugin_);
+        } else {
+            for (const auto& event : parameterEvents_) {
+                if (event.offset > 0) {
+                    setPluginParameter(event.parameter.index, event.value);
+                }
+            }
+        }
+    }
+
+    /** Set parameter by index, without identifier lookup if supported by the plugin. */
+    void setPluginParameter(uint32_t index, float value) {
+        if constexpr (HasParameterHandles<TPlugin>) {
+            plugin_.setParameter(PluginBase::ParameterHandle{index}, value);
+        } else {
+            plugin_.setParameter(TPlugin::parameters[index].identifier, value);
+        }
+    }
+
+    ChannelBuffer makeChannelBuffer(const float* buffer) const {
+        if constexpr (isTimeDomain) {
+            return std::span(buffer, blockSize_);
+        } else {
+            // casts between interleaved arrays and std::complex are guaranteed to be valid
+            // https://en.cppreference.com/w/cpp/numeric/complex
+            // NOLINTNEXTLINE(*reinterpret-cast)
+            return std::span(reinterpret_cast<const std::complex<float>*>(buffer), blockSize_ / 2 + 1);
+        }
+    }
+
+    typename TPlugin::InputBuffer makeInputBuffer(const float* const* inputBuffers) {
+        if constexpr (isMultiChannel) {
+            for (size_t i = 0; i < channels_.size(); ++i) {
+                channels_[i] = makeChannelBuffer(inputBuffers[i]);  // NOLINT(*pointer-arithmetic)
+            }
+            return std::span<const ChannelBuffer>(channels_);
+        } else {
+            return makeChannelBuffer(*inputBuffers);  // only first channel
+        }
+    }
+
     static constexpr bool isValidParameterIndex(auto index) {
         return index >= 0 && std::cmp_less(index, TPlugin::parameters.size());
     }
@@ -353,10 +614,13 @@ private:
     }
 
     TPlugin plugin_;
+    float inputSampleRate_;
     size_t blockSize_{0};
+    std::vector<ChannelBuffer> channels_;  ///< channel buffers for multi-channel plugins
     std::array<VampFeatureList, TPlugin::outputCount> featureLists_{};
     std::array<VampFeatureList, TPlugin::outputCount> featureListsEmpty_{};
-    
+    std::array<RtvampFeature, TPlugin::outputCount>   features_{};
+    std::vector<PluginBase::ParameterEvent> parameterEvents_;  ///< events of the processed block
 };
 
 }  // namespace rtvamp::pluginsdk::detail
@@ -65,20 +65,25 @@ inline void clear(VampFeatureList& featureList) {
     featureList = {};
 }
 
-inline void assignValues(VampFeatureUnion& featureUnion, std::span<const float> values) {
+inline void resizeValues(VampFeatureUnion& featureUnion, size_t valueCount) {
     auto& v1 = featureUnion.v1;
-    if (v1.valueCount != values.size()) {
+    if (v1.valueCount != valueCount || v1.values == nullptr) {
         delete[] v1.values;  // NOLINT
-        v1.values = new float[values.size()]{};  // NOLINT
+        v1.values     = new float[valueCount]{};  // NOLINT
+        v1.valueCount = static_cast<unsigned int>(valueCount);
     }
-    v1.valueCount = static_cast<unsigned int>(values.size());
-    std::copy_n(values.data(), v1.valueCount, v1.values);
 }
 
+inline void assignValues(VampFeatureUnion& featureUnion, std::span<const float> values) {
+    resizeValues(featureUnion, values.size());  // no allocation if value count is unchanged
+    std::copy_n(values.data(), values.size(), featureUnion.v1.values);
+}
+
+/** Feature list with `featureCount` V1 features followed by `featureCount` V2 features (API v2). */
 [[nodiscard]] inline VampFeatureList makeVampFeatureList(size_t featureCount) {
     VampFeatureList featureList{};
     featureList.featureCount = static_cast<unsigned int>(featureCount);
-    featureList.features     = new VampFeatureUnion[featureCount]{};  // NOLINT
+    featureList.features     = new VampFeatureUnion[2 * featureCount]{};  // NOLINT
     return featureList;
 }
 
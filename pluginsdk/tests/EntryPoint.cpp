@@ -24,4 +24,15 @@ TEST_CASE("EntryPoint") {
         // descriptors of the same plugin should point to the same memory location
         REQUIRE(EP::getDescriptor(2, 0) == EP::getDescriptor(2, 1));
     }
+
+    SECTION("Extension") {
+        const auto* descriptor = EP::getDescriptor(2, 0);
+        REQUIRE(EP::getExtension(0, descriptor) == nullptr);
+        REQUIRE(EP::getExtension(RTVAMP_EXTENSION_ABI_VERSION, descriptor) != nullptr);
+        REQUIRE(EP::getExtension(RTVAMP_EXTENSION_ABI_VERSION, nullptr) == nullptr);
+        REQUIRE(
+            EP::getExtension(RTVAMP_EXTENSION_ABI_VERSION, descriptor) ==
+            rtvamp::pluginsdk::detail::PluginAdapter<TestPlugin>::getExtension()
+        );
+    }
 }
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 #include <vamp/vamp.h>
 
@@ -153,11 +154,206 @@ TEST_CASE("PluginAdapter instantiation") {
         d->releaseFeatureSet(remaining); 
     }
 
+    SECTION("Initialise and process with extension") {
+        const RtvampPluginExtension* e = PluginAdapter<TestPlugin>::getExtension();
+        REQUIRE(e != nullptr);
+        REQUIRE(e->abiVersion == RTVAMP_EXTENSION_ABI_VERSION);
+        REQUIRE(e->process != nullptr);
+
+        const std::vector<float> signal{1.1F, 2.2F, 3.3F, 4.4F, 5.5F};
+        d->initialise(h, 1, 5, 5);
+
+        const float*             signalPtr = signal.data();
+        const RtvampFeature*     result    = e->process(h, &signalPtr, 1'000'000'123);
+
+        REQUIRE(result != nullptr);
+        CHECK(result[0].valueCount == 3);
+        CHECK(result[0].values[0] == 1.1F);
+        CHECK(result[0].values[1] == 2.2F);
+        CHECK(result[0].values[2] == 3.3F);
+
+        CHECK(e->process(nullptr, &signalPtr, 0) == nullptr);
+    }
+
     d->cleanup(h);
 }
 
+TEST_CASE("PluginAdapter parameter events") {
+    const std::vector<float> signal{1.0F, 1.0F, 1.0F, 1.0F};
+    const float*             signalPtr = signal.data();
+
+    SECTION("Sample-accurate (PluginExt)") {
+        const VampPluginDescriptor*  d = PluginAdapter<AutomatedGainTestPlugin>::getDescriptor();
+        const RtvampPluginExtension* e = PluginAdapter<AutomatedGainTestPlugin>::getExtension();
+        REQUIRE(e->processWithParameterEvents != nullptr);
+
+        VampPluginHandle h = d->instantiate(d, 48000);
+        REQUIRE(d->initialise(h, 1, 4, 4) == 1);
+
+        const std::vector<RtvampParameterEvent> events{
+            {.offset = 0, .parameterIndex = 0, .value = 2.0F},
+            {.offset = 2, .parameterIndex = 0, .value = 3.0F},
+            {.offset = 3, .parameterIndex = 1, .value = 5.0F},  // invalid index, ignored
+        };
+        const auto* result = e->processWithParameterEvents(
+            h, &signalPtr, 0, events.data(), static_cast<unsigned int>(events.size())
+        );
+        REQUIRE(result != nullptr);
+        CHECK(result[0].values[0] == 2.0F + 2.0F + 3.0F + 3.0F);
+        CHECK(d->getParameter(h, 0) == 3.0F);
+
+        result = e->process(h, &signalPtr, 0);
+        REQUIRE(result != nullptr);
+        CHECK(result[0].values[0] == 4 * 3.0F);
+
+        d->cleanup(h);
+    }
+
+    SECTION("Block boundaries (Plugin)") {
+        const VampPluginDescriptor*  d = PluginAdapter<TestPlugin>::getDescriptor();
+        const RtvampPluginExtension* e = PluginAdapter<TestPlugin>::getExtension();
+
+        VampPluginHandle h = d->instantiate(d, 48000);
+        REQUIRE(d->initialise(h, 1, 4, 4) == 1);
+
+        const std::vector<RtvampParameterEvent> events{
+            {.offset = 0, .parameterIndex = 0, .value = 0.0F},
+            {.offset = 2, .parameterIndex = 0, .value = 2.0F},
+        };
+        const auto* result = e->processWithParameterEvents(
+            h, &signalPtr, 0, events.data(), static_cast<unsigned int>(events.size())
+        );
+        REQUIRE(result != nullptr);
+        CHECK(d->getParameter(h, 0) == 2.0F);  // applied after the block
+
+        d->cleanup(h);
+    }
+}
+
+TEST_CASE("PluginAdapter multi-channel") {
+    const VampPluginDescriptor* d = PluginAdapter<MultiChannelTestPlugin>::getDescriptor();
+
+    VampPluginHandle h = d->instantiate(d, 48000);
+    REQUIRE(h != nullptr);
+
+    CHECK(d->getMinChannelCount(h) == 2);
+    CHECK(d->getMaxChannelCount(h) == 4);
+
+    SECTION("Unsupported channel count") {
+        CHECK(d->initialise(h, 1, 4, 4) == 0);
+        CHECK(d->initialise(h, 5, 4, 4) == 0);
+    }
+
+    SECTION("Process planar channels") {
+        const std::vector<float>  channel0{1.0F, 2.0F, 3.0F, 4.0F};
+        const std::vector<float>  channel1{5.0F, 6.0F, 7.0F, 8.0F};
+        const std::vector<float>  channel2{9.0F, 10.0F, 11.0F, 12.0F};
+        const std::vector<const float*> inputBuffers{channel0.data(), channel1.data(), channel2.data()};
+
+        REQUIRE(d->initialise(h, 3, 4, 4) == 1);
+
+        auto* result = d->process(h, inputBuffers.data(), 0, 0);
+        REQUIRE(result != nullptr);
+        REQUIRE(result[0].features[0].v1.valueCount == 4);
+        CHECK(result[0].features[0].v1.values[0] == 1.0F);
+        CHECK(result[0].features[0].v1.values[1] == 5.0F);
+        CHECK(result[0].features[0].v1.values[2] == 9.0F);
+        CHECK(result[0].features[0].v1.values[3] == 0.0F);
+        d->releaseFeatureSet(result);
+    }
+
+    d->cleanup(h);
+}
+
+TEST_CASE("PluginAdapter stateless and warm-up length") {
+    const RtvampPluginExtension* stateful  = PluginAdapter<TestPlugin>::getExtension();
+    const RtvampPluginExtension* stateless = PluginAdapter<MultiChannelTestPlugin>::getExtension();
+    REQUIRE(stateful->abiVersion >= 3);
+    CHECK(stateful->stateless == 0);
+    CHECK(stateful->warmUpLength == 0);
+    CHECK(stateless->stateless == 1);
+    CHECK(stateless->warmUpLength == 0);
+}
+
+TEST_CASE("PluginAdapter static output descriptors") {
+    const VampPluginDescriptor* dStatic  = PluginAdapter<StaticOutputsTestPlugin>::getDescriptor();
+    const VampPluginDescriptor* dDynamic = PluginAdapter<TestPlugin>::getDescriptor();
+
+    VampPluginHandle hStatic  = dStatic->instantiate(dStatic, 48000);
+    VampPluginHandle hDynamic = dDynamic->instantiate(dDynamic, 48000);
+
+    REQUIRE(dStatic->getOutputDescriptor(hStatic, 99) == nullptr);  // invalid output index
+
+    VampOutputDescriptor* o = dStatic->getOutputDescriptor(hStatic, 0);
+    VampOutputDescriptor* expected = dDynamic->getOutputDescriptor(hDynamic, 0);
+    REQUIRE(o != nullptr);
+    REQUIRE(expected != nullptr);
+
+    CHECK(dStatic->getOutputDescriptor(hStatic, 0) == o);  // no copy
+    CHECK(dStatic->getOutputDescriptor(nullptr, 0) == o);  // independent of instance
+
+    CHECK_THAT(o->identifier,  Equals(expected->identifier));
+    CHECK_THAT(o->name,        Equals(expected->name));
+    CHECK_THAT(o->description, Equals(expected->description));
+    CHECK_THAT(o->unit,        Equals(expected->unit));
+    CHECK(o->hasFixedBinCount == expected->hasFixedBinCount);
+    CHECK(o->binCount == expected->binCount);
+    CHECK_THAT(o->binNames[0], Equals(expected->binNames[0]));
+    CHECK_THAT(o->binNames[2], Equals(expected->binNames[2]));
+    CHECK(o->hasKnownExtents == expected->hasKnownExtents);
+    CHECK(o->minValue == expected->minValue);
+    CHECK(o->maxValue == expected->maxValue);
+    CHECK(o->isQuantized == expected->isQuantized);
+    CHECK(o->sampleType == expected->sampleType);
+
+    dStatic->releaseOutputDescriptor(o);  // no-op
+    CHECK_THAT(o->identifier, Equals("output"));
+
+    dDynamic->releaseOutputDescriptor(expected);
+    dStatic->cleanup(hStatic);
+    dDynamic->cleanup(hDynamic);
+}
+
+TEST_CASE("PluginAdapter instance pool") {
+    const VampPluginDescriptor* d = PluginAdapter<PooledTestPlugin>::getDescriptor();
+
+    VampPluginHandle h = d->instantiate(d, 48000);
+    REQUIRE(h != nullptr);
+    d->setParameter(h, 0, 2.0F);
+    d->selectProgram(h, 1);
+    d->cleanup(h);
+
+    SECTION("Reuse with same sample rate") {
+        VampPluginHandle reused = d->instantiate(d, 48000);
+        CHECK(reused == h);
+        CHECK(d->getParameter(reused, 0) == 1.0F);  // default value restored
+        CHECK(d->getCurrentProgram(reused) == 0);
+        d->cleanup(reused);
+    }
+
+    SECTION("No reuse with different sample rate") {
+        VampPluginHandle other = d->instantiate(d, 44100);
+        CHECK(other != h);
+        d->cleanup(other);
+    }
+
+    SECTION("Pool size exceeded") {
+        std::vector<VampPluginHandle> handles(4);
+        for (auto& handle : handles) {
+            handle = d->instantiate(d, 48000);
+            REQUIRE(handle != nullptr);
+        }
+        for (auto* handle : handles) {
+            d->cleanup(handle);  // instances exceeding the pool size are deleted
+        }
+    }
+}
+
 TEST_CASE("PluginAdapter thread-safety (with thread sanitizer)") {
-    const VampPluginDescriptor* d = PluginAdapter<TestPlugin>::getDescriptor();
+    const VampPluginDescriptor* d = GENERATE(
+        PluginAdapter<TestPlugin>::getDescriptor(),
+        PluginAdapter<PooledTestPlugin>::getDescriptor()
+    );
 
     const uint32_t stepSize  = 512;
     const uint32_t blockSize = 1024;
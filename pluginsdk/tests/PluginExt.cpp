@@ -109,6 +109,28 @@ TEST_CASE("PluginExt get/set parameter") {
     }
 }
 
+TEST_CASE("PluginExt get/set parameter by handle") {
+    TestPluginExt plugin(48000);
+
+    constexpr auto limited   = TestPluginExt::resolveParameter("limited");
+    constexpr auto quantized = TestPluginExt::resolveParameter("quantized");
+    STATIC_REQUIRE(limited.index == 0);
+    STATIC_REQUIRE(quantized.index == 1);
+    STATIC_REQUIRE(HasParameterHandles<TestPluginExt>);
+
+    REQUIRE(plugin.getParameter(limited).value() == 10.0f);
+    REQUIRE(plugin.setParameter(limited, 1e9f));
+    REQUIRE(plugin.getParameter(limited).value() == 10.0f);
+    REQUIRE(plugin.setParameter(quantized, 1.1f));
+    REQUIRE(plugin.getParameter(quantized).value() == 1.0f);
+    REQUIRE(plugin.getParameter("quantized").value() == 1.0f);
+    CHECK(plugin.onParameterChangeId == "quantized");
+
+    const TestPluginExt::ParameterHandle invalid{2};
+    REQUIRE_FALSE(plugin.getParameter(invalid).has_value());
+    REQUIRE_FALSE(plugin.setParameter(invalid, 0.0f));
+}
+
 TEST_CASE("PluginExt get/select program") {
     TestPluginExt plugin(48000);
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>  // fill
+
 #include "rtvamp/pluginsdk.hpp"
 
 class TestPlugin : public rtvamp::pluginsdk::Plugin<1> {
@@ -96,3 +98,134 @@ private:
     float  param_        = 1.0f;
     size_t programIndex_ = 0;
 };
+
+class MultiChannelTestPlugin : public rtvamp::pluginsdk::Plugin<1> {
+public:
+    using Plugin::Plugin;  // inherit constructor
+
+    static constexpr Meta meta{
+        .identifier      = "multichannel",
+        .name            = "Multi-channel test plugin",
+        .inputDomain     = InputDomain::Time,
+        .minChannelCount = 2,
+        .maxChannelCount = 4,
+        .stateless       = true,
+    };
+
+    OutputList getOutputDescriptors() const override {
+        return {
+            OutputDescriptor{
+                .identifier  = "output",
+                .name        = "Output",
+                .description = "Output of all channels",
+                .unit        = "",
+                .binCount    = 4,
+            },
+        };
+    }
+
+    void reset() override {};
+
+    bool initialise(uint32_t stepSize, uint32_t blockSize) override {
+        initialiseFeatureSet();
+        return true;
+    };
+
+    // feature values: first sample of each channel
+    const FeatureSet& process(InputBuffer buffer, uint64_t nsec) override {
+        auto  channels = std::get<TimeDomainChannels>(buffer);
+        auto& result   = getFeatureSet();
+        std::fill(result[0].begin(), result[0].end(), 0.0f);
+        for (size_t i = 0; i < channels.size() && i < getInputChannelCount(); ++i) {
+            result[0][i] = channels[i][0];
+        }
+        return result;
+    };
+};
+
+class PooledTestPlugin : public TestPlugin {
+public:
+    using TestPlugin::TestPlugin;  // inherit constructor
+
+    static constexpr size_t instancePoolSize = 2;
+};
+
+class StaticOutputsTestPlugin : public TestPlugin {
+public:
+    using TestPlugin::TestPlugin;  // inherit constructor
+
+    static constexpr std::array<const char*, 3> binNames{"a", "b", "c"};
+    static constexpr std::array outputs{
+        StaticOutputDescriptor{
+            .identifier      = "output",
+            .name            = "Output",
+            .description     = "Some random output",
+            .unit            = "V",
+            .binCount        = 3,
+            .binNames        = binNames,
+            .hasKnownExtents = true,
+            .minValue        = 0.0f,
+            .maxValue        = 10.0f,
+        },
+    };
+
+    OutputList getOutputDescriptors() const override {
+        return makeOutputList(outputs);
+    }
+};
+
+class AutomatedGainTestPlugin : public rtvamp::pluginsdk::PluginExt<AutomatedGainTestPlugin, 1> {
+public:
+    using PluginExt::PluginExt;  // inherit constructor
+
+    static constexpr Meta meta{
+        .identifier  = "automatedgain",
+        .name        = "Automated gain test plugin",
+        .inputDomain = InputDomain::Time,
+    };
+
+    static constexpr std::array parameters{
+        ParameterDescriptor{
+            .identifier   = "gain",
+            .name         = "Gain",
+            .defaultValue = 1.0f,
+            .minValue     = 0.0f,
+            .maxValue     = 10.0f,
+        },
+    };
+
+    OutputList getOutputDescriptors() const override {
+        return {
+            OutputDescriptor{
+                .identifier  = "sum",
+                .name        = "Sum",
+                .description = "Sum of the samples multiplied by the gain",
+                .unit        = "",
+                .binCount    = 1,
+            },
+        };
+    }
+
+    void reset() override {};
+
+    bool initialise(uint32_t stepSize, uint32_t blockSize) override {
+        initialiseFeatureSet();
+        return true;
+    };
+
+    // feature value: sum of the samples multiplied by the (sample-accurate) gain
+    const FeatureSet& process(InputBuffer buffer, uint64_t nsec) override {
+        constexpr auto gain   = resolveParameter("gain");
+        const auto     signal = std::get<TimeDomainBuffer>(buffer);
+        float          sum    = 0.0f;
+        forEachParameterSegment(static_cast<uint32_t>(signal.size()), [&](uint32_t begin, uint32_t end) {
+            const float value = getParameter(gain).value();
+            for (uint32_t i = begin; i < end; ++i) {
+                sum += value * signal[i];
+            }
+        });
+        auto& result = getFeatureSet();
+        result[0][0] = sum;
+        return result;
+    };
+};
@@ -70,4 +70,28 @@ TEST_CASE("VampFeatureUnion") {
         CHECK(featureUnion.v1.values[2] == values[2]);
         detail::clear(featureUnion);
     }
+
+    SECTION("resizeValues before assignValues (no reallocation)") {
+        VampFeatureUnion featureUnion{};
+        detail::resizeValues(featureUnion, 2);
+        CHECK(featureUnion.v1.valueCount == 2);
+        const auto* data = featureUnion.v1.values;
+        REQUIRE(data != nullptr);
+
+        const std::vector<float> values{1.0F, 2.0F};
+        detail::assignValues(featureUnion, values);
+        CHECK(featureUnion.v1.values == data);
+        CHECK(featureUnion.v1.values[1] == values[1]);
+        detail::clear(featureUnion);
+    }
+}
+
+TEST_CASE("VampFeatureList") {
+    auto featureList = detail::makeVampFeatureList(2);
+    CHECK(featureList.featureCount == 2);
+    REQUIRE(featureList.features != nullptr);
+    // V1 features followed by V2 features (Vamp API version 2)
+    CHECK(featureList.features[2].v2.hasDuration == 0);
+    CHECK(featureList.features[3].v2.hasDuration == 0);
+    detail::clear(featureList);
 }
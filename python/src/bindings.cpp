@@ -5,6 +5,7 @@
 #include <optional>
 #include <span>
 #include <stdexcept>
+#include <tuple>
 #include <vector>
 
 #include <pybind11/pybind11.h>
@@ -25,6 +26,10 @@ using PluginLibrary = rtvamp::hostsdk::PluginLibrary;
 using PyTimeDomainBuffer      = py::array_t<float, py::array::c_style | py::array::forcecast>;
 using PyFrequencyDomainBuffer = py::array_t<std::complex<float>, py::array::c_style | py::array::forcecast>;
 using PyInputBuffer           = std::variant<PyTimeDomainBuffer, PyFrequencyDomainBuffer>;
+using PyTimeDomainFrames      = py::array_t<float, py::array::forcecast>;  // any strides, e.g. overlapping frames
+using PyFrequencyDomainFrames = py::array_t<std::complex<float>, py::array::forcecast>;
+using PyInputFrames           = std::variant<PyTimeDomainFrames, PyFrequencyDomainFrames>;
+using PyTimestamps            = py::array_t<uint64_t, py::array::c_style | py::array::forcecast>;
 
 /**
  * Trampoline for Plugin class.
@@ -71,6 +76,18 @@ public:
     bool setParameter(std::string_view id, float value) override {
         PYBIND11_OVERRIDE_PURE(bool, Plugin, setParameter, id, value);
     }
+    std::optional<ParameterHandle> resolveParameter(std::string_view id) const override {
+        PYBIND11_OVERRIDE_PURE(std::optional<ParameterHandle>, Plugin, resolveParameter, id);
+    }
+    std::optional<float> getParameter(ParameterHandle handle) const override {
+        PYBIND11_OVERRIDE_PURE(std::optional<float>, Plugin, getParameter, handle);
+    }
+    bool setParameter(ParameterHandle handle, float value) override {
+        PYBIND11_OVERRIDE_PURE(bool, Plugin, setParameter, handle, value);
+    }
+    void scheduleParameterEvents(ParameterEventList events) override {
+        PYBIND11_OVERRIDE_PURE(void, Plugin, scheduleParameterEvents, events);
+    }
     ProgramList getPrograms() const noexcept override {
         PYBIND11_OVERRIDE_PURE(ProgramList, Plugin, getPrograms);
     }
@@ -92,8 +109,20 @@ public:
     OutputList getOutputDescriptors() const override {
         PYBIND11_OVERRIDE_PURE(OutputList, Plugin, getOutputDescriptors);
     }
-    bool initialise(uint32_t stepSize, uint32_t blockSize) override {
-        PYBIND11_OVERRIDE_PURE(bool, Plugin, initialise, stepSize, blockSize);
+    uint32_t getMinChannelCount() const override {
+        PYBIND11_OVERRIDE_PURE(uint32_t, Plugin, getMinChannelCount);
+    }
+    uint32_t getMaxChannelCount() const override {
+        PYBIND11_OVERRIDE_PURE(uint32_t, Plugin, getMaxChannelCount);
+    }
+    bool isStateless() const override {
+        PYBIND11_OVERRIDE_PURE(bool, Plugin, isStateless);
+    }
+    uint32_t getWarmUpLength() const override {
+        PYBIND11_OVERRIDE_PURE(uint32_t, Plugin, getWarmUpLength);
+    }
+    bool initialise(uint32_t stepSize, uint32_t blockSize, uint32_t channelCount) override {
+        PYBIND11_OVERRIDE_PURE(bool, Plugin, initialise, stepSize, blockSize, channelCount);
     }
     void reset() override {
         PYBIND11_OVERRIDE_PURE(void, Plugin, reset);
@@ -101,6 +130,18 @@ public:
     FeatureSet process(InputBuffer buffer, uint64_t nsec) override {
         PYBIND11_OVERRIDE_PURE(FeatureSet, Plugin, process, buffer, nsec);
     }
+    FeatureViewSet processView(InputBuffer buffer, uint64_t nsec) override {
+        PYBIND11_OVERRIDE_PURE(FeatureViewSet, Plugin, processView, buffer, nsec);
+    }
+    void processBatch(const InputBlocks& blocks, FeatureMatrix features) override {
+        PYBIND11_OVERRIDE_PURE(void, Plugin, processBatch, blocks, features);
+    }
+    FeatureEventSet processEvents(InputBuffer buffer, uint64_t nsec) override {
+        PYBIND11_OVERRIDE_PURE(FeatureEventSet, Plugin, processEvents, buffer, nsec);
+    }
+    FeatureEventSet getRemainingFeatures() override {
+        PYBIND11_OVERRIDE_PURE(FeatureEventSet, Plugin, getRemainingFeatures);
+    }
     // NOLINTEND(bugprone-exception-escape)
 };
 
@@ -133,6 +174,31 @@ static std::span<const T> convertNumpyArrayToSpan(const py::array_t<T, ExtraFlag
     };
 }
 
+/**
+ * Map a 2D array of frames [nframes, blocksize] to a buffer with a constant hop size between the
+ * frames without copying, e.g. the overlapping frames of a strided view.
+ * Arrays with other memory layouts (e.g. non-contiguous frames) are copied to a C-contiguous array.
+ */
+template <typename T>
+static auto convertNumpyFramesToBuffer(py::array_t<T, py::array::forcecast>& frames) {
+    if (frames.ndim() != 2) {
+        throw std::invalid_argument("Numpy array dimension must be 2 (frames, block size)");
+    }
+    constexpr auto itemSize = static_cast<py::ssize_t>(sizeof(T));
+    const bool     strided  = frames.strides(1) == itemSize && frames.strides(0) >= 0 &&
+                         frames.strides(0) % itemSize == 0;
+    if (!strided) {
+        frames = py::array_t<T, py::array::forcecast>(
+            py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(frames)
+        );
+    }
+    const auto frameCount = static_cast<size_t>(frames.shape(0));
+    const auto frameSize  = static_cast<size_t>(frames.shape(1));
+    const auto hopSize    = static_cast<size_t>(frames.strides(0) / itemSize);
+    const auto size       = frameCount == 0 ? 0 : (frameCount - 1) * hopSize + frameSize;
+    return std::make_pair(std::span<const T>(frames.data(), size), hopSize);
+}
+
 PYBIND11_MODULE(_bindings, m) {
     m.def(
         "get_vamp_paths",
@@ -239,6 +305,13 @@ PYBIND11_MODULE(_bindings, m) {
             py::return_value_policy::take_ownership
         );
 
+    py::class_<Plugin::ParameterHandle>(
+        m,
+        "ParameterHandle",
+        "Resolved parameter to get/set the value without identifier lookup (see :meth:`Plugin.resolve_parameter`)."
+    )
+        .def_readonly("index", &Plugin::ParameterHandle::index);
+
     py::class_<Plugin, PyPlugin /* trampoline */>(
         m,
         "Plugin",
@@ -278,8 +351,23 @@ PYBIND11_MODULE(_bindings, m) {
             }
             return result;
         })
-        .def("get_parameter", &Plugin::getParameter, py::arg("id"))
-        .def("set_parameter", &Plugin::setParameter, py::arg("id"), py::arg("value"))
+        .def("get_parameter", py::overload_cast<std::string_view>(&Plugin::getParameter, py::const_), py::arg("id"))
+        .def("get_parameter", py::overload_cast<Plugin::ParameterHandle>(&Plugin::getParameter, py::const_), py::arg("handle"))
+        .def("set_parameter", py::overload_cast<std::string_view, float>(&Plugin::setParameter), py::arg("id"), py::arg("value"))
+        .def("set_parameter", py::overload_cast<Plugin::ParameterHandle, float>(&Plugin::setParameter), py::arg("handle"), py::arg("value"))
+        .def("resolve_parameter", &Plugin::resolveParameter, py::arg("id"))
+        .def(
+            "schedule_parameter_events",
+            [](Plugin& self, const std::vector<std::tuple<uint32_t, Plugin::ParameterHandle, float>>& events) {
+                std::vector<Plugin::ParameterEvent> result;
+                result.reserve(events.size());
+                for (auto&& [offset, parameter, value] : events) {
+                    result.push_back({offset, parameter, value});
+                }
+                self.scheduleParameterEvents(result);
+            },
+            py::arg("events")
+        )
         .def("get_programs", [](const Plugin& self) {
             return convertSpanToVector(self.getPrograms());
         })
@@ -306,7 +394,17 @@ PYBIND11_MODULE(_bindings, m) {
             }
             return result;
         })
-        .def("initialise", &Plugin::initialise, py::arg("stepsize"), py::arg("blocksize"))
+        .def("get_min_channel_count", &Plugin::getMinChannelCount)
+        .def("get_max_channel_count", &Plugin::getMaxChannelCount)
+        .def("is_stateless", &Plugin::isStateless)
+        .def("get_warm_up_length", &Plugin::getWarmUpLength)
+        .def(
+            "initialise",
+            py::overload_cast<uint32_t, uint32_t, uint32_t>(&Plugin::initialise),
+            py::arg("stepsize"),
+            py::arg("blocksize"),
+            py::arg("channels") = 1
+        )
         .def("reset", &Plugin::reset)
         .def(
             "process",
@@ -321,5 +419,62 @@ PYBIND11_MODULE(_bindings, m) {
             },
             py::arg("array"),
             py::arg("nsec")
+        )
+        .def(
+            "process_frames",
+            [](Plugin& self, PyInputFrames frames, const PyTimestamps& timestamps) {
+                const auto nsec    = convertNumpyArrayToSpan(timestamps);
+                const auto outputs = self.getOutputDescriptors();
+                size_t     rowSize = 0;
+                for (auto&& output : outputs) {
+                    rowSize += output.binCount;
+                }
+
+                // one feature matrix for all outputs, returned as views per output
+                py::array_t<float> matrix({nsec.size(), rowSize});
+                float* const       matrixData = matrix.mutable_data();
+                std::visit(
+                    [&](auto&& numpyArray) {
+                        const auto [buffer, hopSize] = convertNumpyFramesToBuffer(numpyArray);
+                        if (static_cast<size_t>(numpyArray.shape(0)) != nsec.size()) {
+                            throw std::invalid_argument("Number of frames and timestamps must match");
+                        }
+                        const py::gil_scoped_release release;
+                        self.processBatch(
+                            {.buffer = buffer, .hopSize = hopSize, .timestamps = nsec},
+                            {matrixData, nsec.size() * rowSize}
+                        );
+                    },
+                    frames
+                );
+
+                std::vector<py::array_t<float>> result;
+                size_t                           offset = 0;
+                for (auto&& output : outputs) {
+                    result.emplace_back(
+                        std::vector<size_t>{nsec.size(), output.binCount},
+                        std::vector<size_t>{rowSize * sizeof(float), sizeof(float)},
+                        matrix.data() + offset,
+                        matrix
+                    );
+                    offset += output.binCount;
+                }
+                return result;
+            },
+            R"pbdoc(
+                Process multiple frames with a single call (GIL released during processing).
+
+                Args:
+                    frames: 2D array of frames [nframes, blocksize], time domain (float32) or
+                        frequency domain (complex64, blocksize / 2 + 1 bins).
+                        Frames with a constant hop size, e.g. the overlapping frames of a strided
+                        view, are processed without copying.
+                    timestamps: Timestamps of the frames in nanoseconds
+
+                Returns:
+                    List of feature arrays [nframes, bincount] for each output
+            )pbdoc",
+            py::arg("frames"),
+            py::arg("timestamps")
         );
 }
@@ -2,6 +2,7 @@
 
 from __future__ import annotations
 
+import struct
 from dataclasses import dataclass
 from typing import TYPE_CHECKING, Any, List
 
@@ -81,6 +82,9 @@ Feature = List[float]
 FeatureList = List[Feature]
 
 
+_SPECTRUM_BATCH_SIZE = 1024  # frames per batch of spectra in FeatureComputation.process_signal
+
+
 def _frame_count(nsamples: int, blocksize: int, stepsize: int):
     return (nsamples - blocksize) // stepsize + 1  # nsamples = blocksize + (nframes - 1) * stepsize
 
@@ -130,6 +134,7 @@ class FeatureComputation:
         self._blocksize = 0
         self._stepsize = 0
         self._window = np.empty(0, dtype=np.float32)
+        self._windowed = np.empty(0, dtype=np.float32)
 
     @property
     def plugins(self) -> list[Plugin]:
@@ -177,6 +182,7 @@ class FeatureComputation:
         self._blocksize = blocksize
         self._stepsize = stepsize or blocksize
         self._window = np.hanning(blocksize).astype(np.float32, copy=False)
+        self._windowed = np.empty(blocksize, dtype=np.float32)  # reused for each block
         for plugin in self._plugins:
             success = plugin.initialise(
                 stepsize=self._stepsize,
@@ -214,11 +220,10 @@ class FeatureComputation:
             Check `bin_count` with :func:`get_output_descriptors`.
         """
         timedata_block = timedata_block.astype(np.float32, copy=False)
-        fft_block = (
-            np.fft.rfft(timedata_block * self._window).astype(np.complex64, copy=False)
-            if self._is_frequency_domain_required()
-            else None
-        )
+        fft_block = None
+        if self._is_frequency_domain_required():
+            np.multiply(timedata_block, self._window, out=self._windowed)
+            fft_block = np.fft.rfft(self._windowed).astype(np.complex64, copy=False)
 
         results = []
         for plugin in self._plugins:
@@ -245,24 +250,32 @@ class FeatureComputation:
             - List of arrays of computed features (same length as timestamps).
               Check :attr:`~outputs` to map the arrays to the plugin outputs.
         """
-        nframes = _frame_count(timedata.shape[0], self._blocksize, self._stepsize)
-        outputs = [
-            np.empty(shape=(d["bin_count"], nframes), dtype=np.float32)
-            for d in self.get_output_descriptors()
-        ]
-
-        timestamp_inc = self._stepsize / self._samplerate
-        timestamp = timestamp_start
-        for i, timedata_block in enumerate(
-            _frame(timedata, blocksize=self._blocksize, stepsize=self._stepsize)
-        ):
-            results = self.process_block(timedata_block, timestamp=timestamp)
-            assert len(outputs) == len(results)
-            for output, result in zip(outputs, results):
-                output[:, i] = result
-            timestamp += timestamp_inc
-
-        timestamps = np.arange(0, nframes) * timestamp_inc + timestamp_start
+        timedata = np.asarray(timedata, dtype=np.float32)  # convert once, frames are views
+        frames = _frame(timedata, blocksize=self._blocksize, stepsize=self._stepsize)
+        nframes = frames.shape[0]
+        timestamps = np.arange(0, nframes) * (self._stepsize / self._samplerate) + timestamp_start
+        timestamps_nsec = (timestamps * 1e9).astype(np.uint64)
+
+        # process all frames per plugin in C++, spectra are computed in batches to bound memory
+        outputs = []
+        for plugin in self._plugins:
+            if plugin.get_input_domain() == "frequency":
+                results = [
+                    np.empty(shape=(nframes, d["bin_count"]), dtype=np.float32)
+                    for d in plugin.get_output_descriptors()
+                ]
+                for start in range(0, nframes, _SPECTRUM_BATCH_SIZE):
+                    stop = min(start + _SPECTRUM_BATCH_SIZE, nframes)
+                    spectra = np.fft.rfft(frames[start:stop] * self._window, axis=1)
+                    batch = plugin.process_frames(
+                        spectra.astype(np.complex64, copy=False), timestamps_nsec[start:stop]
+                    )
+                    for result, result_batch in zip(results, batch):
+                        result[start:stop] = result_batch
+            else:
+                results = plugin.process_frames(frames, timestamps_nsec)
+            outputs.extend(result.T for result in results)  # views with shape (bin_count, nframes)
+
         return timestamps, outputs
 
 
@@ -306,3 +319,99 @@ def compute_features(
     timestamps, outputs = proc.process_signal(timedata)
     assert len(outputs) == 1
     return timestamps, outputs[0]
+
+
+@dataclass
+class FeatureFile:
+    """Content of a columnar feature file (see :func:`read_feature_file`)."""
+
+    plugin_key: str
+    samplerate: float
+    stepsize: int
+    blocksize: int
+    output_descriptors: list[dict[str, Any]]
+    timestamps: np.ndarray
+    outputs: list[np.ndarray]
+
+
+_FEATURE_FILE_MAGIC = b"RTVFEAT\0"
+_FEATURE_FILE_VERSION = 1
+
+
+def read_feature_file(path: PathLike | str) -> FeatureFile:
+    """
+    Read a columnar feature file written by the C++ hostsdk (`FeatureFileWriter`).
+
+    The file is memory-mapped, the feature arrays are read-only views into the mapped file
+    without copying.
+
+    Args:
+        path: Path of the feature file
+
+    Returns:
+        Plugin key, descriptors and the timestamps in seconds with the features of each output.
+        The feature arrays have the shape (`bin_count`, number of blocks), like the outputs of
+        :func:`FeatureComputation.process_signal`.
+    """
+    data = np.memmap(path, dtype=np.uint8, mode="r")
+    buffer = memoryview(data)
+
+    def read(fmt: str, offset: int):
+        try:
+            return struct.unpack_from(fmt, buffer, offset)
+        except struct.error as e:
+            msg = f"Invalid feature file {path}: unexpected end of header"
+            raise ValueError(msg) from e
+
+    def read_string(offset: int, size: int) -> str:
+        if offset + size > len(buffer):
+            msg = f"Invalid feature file {path}: unexpected end of header"
+            raise ValueError(msg)
+        return bytes(buffer[offset : offset + size]).decode()
+
+    (magic,) = read("<8s", 0)
+    if magic != _FEATURE_FILE_MAGIC:
+        msg = f"Invalid feature file {path}: wrong magic number"
+        raise ValueError(msg)
+    (version, _, samplerate, stepsize, blocksize, output_count, row_count, key_size) = read(
+        "<IIfIIIQI", 8
+    )
+    if version != _FEATURE_FILE_VERSION:
+        msg = f"Invalid feature file {path}: unsupported version {version}"
+        raise ValueError(msg)
+
+    cursor = 64
+    plugin_key = read_string(cursor, key_size)
+    cursor += key_size
+
+    descriptors = []
+    outputs = []
+    for _ in range(output_count):
+        bin_count, identifier_size, name_size, unit_size, offset = read("<IIIIQ", cursor)
+        cursor += 24
+        identifier = read_string(cursor, identifier_size)
+        cursor += identifier_size
+        name = read_string(cursor, name_size)
+        cursor += name_size
+        unit = read_string(cursor, unit_size)
+        cursor += unit_size
+
+        if offset + row_count * bin_count * 4 > len(buffer):
+            msg = f"Invalid feature file {path}: features of output {identifier} exceed file size"
+            raise ValueError(msg)
+        features = np.frombuffer(buffer, dtype="<f4", count=row_count * bin_count, offset=offset)
+        descriptors.append(
+            {"identifier": identifier, "name": name, "unit": unit, "bin_count": bin_count}
+        )
+        outputs.append(features.reshape(row_count, bin_count).T)
+
+    timestamps = np.arange(row_count) * stepsize / samplerate
+    return FeatureFile(
+        plugin_key=plugin_key,
+        samplerate=samplerate,
+        stepsize=stepsize,
+        blocksize=blocksize,
+        output_descriptors=descriptors,
+        timestamps=timestamps,
+        outputs=outputs,
+    )
@@ -0,0 +1,97 @@
+import struct
+from pathlib import Path
+
+import numpy as np
+import pytest
+from numpy.testing import assert_allclose, assert_array_equal
+from rtvamp import read_feature_file
+
+
+def write_feature_file(path, plugin_key: str, samplerate: float, stepsize: int, outputs):
+    """Write feature file with the layout of the C++ `FeatureFileWriter`."""
+
+    def align(offset: int):
+        return (offset + 63) // 64 * 64
+
+    row_count = outputs[0][1].shape[0] if outputs else 0
+    header_size = 64 + len(plugin_key) + sum(24 + len(identifier) for identifier, _ in outputs)
+    offsets = []
+    offset = align(header_size)
+    for _, features in outputs:
+        offsets.append(offset)
+        offset = align(offset + features.nbytes)
+
+    header = struct.pack(
+        "<8sIIfIIIQI",
+        b"RTVFEAT\0",
+        1,
+        align(header_size),
+        samplerate,
+        stepsize,
+        stepsize,
+        len(outputs),
+        row_count,
+        len(plugin_key),
+    )
+    header = header.ljust(64, b"\0") + plugin_key.encode()
+    for (identifier, features), offset in zip(outputs, offsets):
+        header += struct.pack("<IIIIQ", features.shape[1], len(identifier), 0, 0, offset)
+        header += identifier.encode()
+
+    with open(path, "wb") as f:
+        f.write(header)
+        for (_, features), offset in zip(outputs, offsets):
+            f.write(b"\0" * (offset - f.tell()))
+            f.write(features.astype("<f4").tobytes())
+
+
+def test_read_feature_file(tmp_path):
+    path = tmp_path / "features.rtvfeat"
+    rms = np.arange(10, dtype=np.float32).reshape(10, 1)
+    spectrum = np.arange(30, dtype=np.float32).reshape(10, 3)
+    outputs = [("rms", rms), ("spectrum", spectrum)]
+    write_feature_file(path, "example-plugin:rms", 1000, 100, outputs)
+
+    result = read_feature_file(path)
+    assert result.plugin_key == "example-plugin:rms"
+    assert result.samplerate == 1000
+    assert result.stepsize == 100
+    assert [d["identifier"] for d in result.output_descriptors] == ["rms", "spectrum"]
+    assert [d["bin_count"] for d in result.output_descriptors] == [1, 3]
+    assert_allclose(result.timestamps, np.arange(10) * 0.1)
+
+    assert len(result.outputs) == 2
+    assert result.outputs[0].shape == (1, 10)
+    assert result.outputs[1].shape == (3, 10)
+    assert_array_equal(result.outputs[0], rms.T)
+    assert_array_equal(result.outputs[1], spectrum.T)
+    assert not result.outputs[1].flags.writeable
+
+
+def test_read_feature_file_written_by_hostsdk():
+    # written by the C++ FeatureFileWriter, hostsdk/tests/FeatureFile.cpp checks it is up to date
+    path = Path(__file__).parent / "data" / "features.rtvfeat"
+
+    result = read_feature_file(path)
+    assert result.plugin_key == "example-plugin:rms"
+    assert result.samplerate == 48000
+    assert result.stepsize == 512
+    assert result.blocksize == 1024
+    assert result.output_descriptors == [
+        {"identifier": "rms", "name": "RMS", "unit": "V", "bin_count": 1},
+        {"identifier": "spectrum", "name": "Spectrum", "unit": "", "bin_count": 3},
+    ]
+    assert_allclose(result.timestamps, np.arange(4) * 512 / 48000)
+
+    rows = np.arange(4, dtype=np.float32)
+    assert_array_equal(result.outputs[0], [rows])
+    assert_array_equal(result.outputs[1], [rows, rows + 0.25, rows + 0.5])
+    for output in result.outputs:
+        assert output.ctypes.data % 64 == 0  # aligned in the mapped file
+
+
+def test_read_feature_file_invalid(tmp_path):
+    path = tmp_path / "invalid.rtvfeat"
+    path.write_bytes(b"not a feature file")
+    with pytest.raises(ValueError):
+        read_feature_file(path)
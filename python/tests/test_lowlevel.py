@@ -99,3 +99,29 @@ def test_plugin(fixture_vamp_path):
     input_timedomain = np.zeros(16).astype(np.float32)
     result = plugin.process(input_timedomain, nsec=0)
     assert result == [[0.0]]
+
+
+def test_plugin_process_frames(fixture_vamp_path):
+    plugin = rtvamp.load_plugin("example-plugin:rms", 48000)
+    plugin.initialise(stepsize=8, blocksize=16)
+
+    signal = np.arange(64, dtype=np.float32)
+    frames = rtvamp._frame(signal, blocksize=16, stepsize=8)  # overlapping strided view
+    timestamps = np.arange(frames.shape[0], dtype=np.uint64) * 1000
+
+    results = plugin.process_frames(frames, timestamps)
+    assert len(results) == 1
+    assert results[0].shape == (frames.shape[0], 1)
+    assert results[0].dtype == np.float32
+
+    expected = [plugin.process(frame, nsec=0)[0][0] for frame in frames]
+    np.testing.assert_allclose(results[0][:, 0], expected)
+
+    # frames with a larger hop size
+    results_copy = plugin.process_frames(frames[::2], timestamps[::2])
+    np.testing.assert_allclose(results_copy[0][:, 0], expected[::2])
+
+    with pytest.raises(ValueError):
+        plugin.process_frames(frames, timestamps[:-1])
+    with pytest.raises(ValueError):
+        plugin.process_frames(signal, timestamps)
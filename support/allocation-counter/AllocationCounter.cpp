@@ -0,0 +1,126 @@
+#include "AllocationCounter.hpp"
+
+#include <cerrno>  // ENOMEM
+#include <cstdlib>
+#include <new>
+#include <utility>  // exchange
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+#define RTVAMP_SANITIZER
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define RTVAMP_SANITIZER
+#endif
+
+// sanitizers intercept malloc themselves
+#if defined(__GLIBC__) && !defined(RTVAMP_SANITIZER)
+#define RTVAMP_HOOK_MALLOC
+#endif
+
+static thread_local size_t* activeCounter = nullptr;  // trivial type, access does not allocate
+
+static void countAllocation() noexcept {
+    if (activeCounter != nullptr) {
+        ++*activeCounter;
+    }
+}
+
+AllocationCounter::AllocationCounter() noexcept : previous_(std::exchange(activeCounter, &count_)) {}
+
+AllocationCounter::~AllocationCounter() {
+    activeCounter = previous_;
+}
+
+bool AllocationCounter::countsLibraryAllocations() noexcept {
+#ifdef RTVAMP_HOOK_MALLOC
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef RTVAMP_HOOK_MALLOC
+
+// NOLINTBEGIN(*reserved-identifier, *identifier-naming, readability-inconsistent-declaration-parameter-name)
+extern "C" {
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+
+// replace the glibc functions, also used by operator new and dynamically loaded libraries
+
+void* malloc(size_t size) noexcept {
+    countAllocation();
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) noexcept {
+    countAllocation();
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) noexcept {
+    countAllocation();
+    return __libc_realloc(ptr, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) noexcept {
+    countAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) noexcept {
+    countAllocation();
+    *ptr = __libc_memalign(alignment, size);
+    return *ptr != nullptr ? 0 : ENOMEM;
+}
+
+}
+// NOLINTEND(*reserved-identifier, *identifier-naming, readability-inconsistent-declaration-parameter-name)
+
+#else
+
+// replace the global operator new (not used by dynamically loaded libraries on all platforms)
+
+void* operator new(size_t size) {
+    countAllocation();
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t& /* tag */) noexcept {
+    countAllocation();
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+    return ::operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /* size */) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t /* size */) noexcept {
+    std::free(ptr);
+}
+
+#endif
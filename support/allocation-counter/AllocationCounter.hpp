@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Count heap allocations of the current thread during the lifetime of the counter.
+ *
+ * Allocations are counted by the replaced allocation functions in AllocationCounter.cpp, which
+ * must be linked into the executable: `malloc` & co. with glibc (also covers allocations in
+ * dynamically loaded plugin libraries), otherwise the global `operator new`.
+ * Counters can be nested, only the innermost counter is incremented.
+ */
+class AllocationCounter {
+public:
+    AllocationCounter() noexcept;
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter(AllocationCounter&&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(AllocationCounter&&) = delete;
+
+    size_t count() const noexcept { return count_; }
+    void   reset() noexcept { count_ = 0; }
+
+    /** Check if allocations of dynamically loaded libraries are counted as well. */
+    static bool countsLibraryAllocations() noexcept;
+
+private:
+    size_t  count_{0};
+    size_t* previous_;
+};